@@ -4,7 +4,13 @@
 #include <QStandardPaths>
 #include <QMessageBox>
 #include <QIcon>
+#include <QCommandLineParser>
+#include <QTextStream>
 #include "core/Application.h"
+#include "core/StallMonitor.h"
+#include "core/InteractionBenchmark.h"
+#include "core/FootprintReport.h"
+#include "utils/ConfigManager.h"
 #include "views/MainWindow.h"
 
 int main(int argc, char *argv[])
@@ -18,19 +24,78 @@ int main(int argc, char *argv[])
     qputenv("QT_ENABLE_HIGHDPI_SCALING", "0");
 #endif
 
-    QApplication app(argc, argv);
+    // Lets the stall monitor time every event delivery
+    MonitoredApplication app(argc, argv);
 
     // Set application icon
     app.setWindowIcon(QIcon(":/images/nemours-logo.png"));
 
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Safe Airway");
+    parser.addHelpOption();
+    QCommandLineOption kioskOption("kiosk", "Show a saved case full-screen as a bedside display.", "case.json");
+    parser.addOption(kioskOption);
+    QCommandLineOption wallOption("wall", "Show every active tracheostomy case as a wall display.");
+    parser.addOption(wallOption);
+    QCommandLineOption diagnosticsOption("diagnostics", "Record event loop stalls (Debug > Stall Diagnostics).");
+    parser.addOption(diagnosticsOption);
+    QCommandLineOption benchmarkOption("benchmark", "Run the interaction latency benchmark and exit.");
+    parser.addOption(benchmarkOption);
+    QCommandLineOption benchmarkIterationsOption("benchmark-iterations", "Samples per benchmark (default 50).", "count", "50");
+    parser.addOption(benchmarkIterationsOption);
+    QCommandLineOption benchmarkBaselineOption("benchmark-baseline", "Compare with this baseline, or create it if missing.", "file");
+    parser.addOption(benchmarkBaselineOption);
+    QCommandLineOption benchmarkUpdateOption("benchmark-update-baseline", "Overwrite the baseline with this run.");
+    parser.addOption(benchmarkUpdateOption);
+    QCommandLineOption footprintOption("footprint-report", "Write the per-view footprint report (- for stdout) and exit.", "file");
+    parser.addOption(footprintOption);
+    parser.process(app);
+
     if (!Application::instance().initialize(&app)) {
         QMessageBox::critical(nullptr, "Initialization Error", 
                             "Failed to initialize the application. Please check your installation.");
         return -1;
     }
     
+    if (parser.isSet(diagnosticsOption) || ConfigManager::instance().isStallMonitorEnabled()) {
+        StallMonitor::instance().setThresholdMs(ConfigManager::instance().getStallThresholdMs());
+        StallMonitor::instance().start();
+    }
+    
     MainWindow window;
     window.show();
+
+    if (parser.isSet(benchmarkOption)) {
+        InteractionBenchmark::Options options;
+        options.iterations = parser.value(benchmarkIterationsOption).toInt();
+        options.baselinePath = parser.value(benchmarkBaselineOption);
+        options.updateBaseline = parser.isSet(benchmarkUpdateOption);
+
+        int result = InteractionBenchmark(&window, options).run();
+        Application::instance().shutdown();
+        return result;
+    }
+
+    if (parser.isSet(footprintOption)) {
+        // Let the window lay out and paint once, so its backing store exists
+        for (int i = 0; i < 3; ++i) {
+            app.processEvents();
+        }
+
+        QString errorMessage;
+        bool written = FootprintReport::write(window.footprintReport(), parser.value(footprintOption), &errorMessage);
+        if (!written) {
+            QTextStream(stderr) << errorMessage << "\n";
+        }
+        Application::instance().shutdown();
+        return written ? 0 : 1;
+    }
+
+    if (parser.isSet(kioskOption)) {
+        window.showKioskDisplay(parser.value(kioskOption));
+    } else if (parser.isSet(wallOption)) {
+        window.showWallDisplay();
+    }
     
     int result = app.exec();
     
@@ -1,4 +1,6 @@
-QT += core widgets printsupport
+QT += core widgets printsupport concurrent
+# Optional: lets stall diagnostics name the signal behind a slow queued call
+!isEmpty(QT.core_private.name): QT += core-private
 
 CONFIG += c++17
 
@@ -9,22 +11,42 @@ SOURCES += \
     main.cpp \
     src/core/Application.cpp \
     src/core/CaseManager.cpp \
+    src/core/AutoSaveScheduler.cpp \
+    src/core/CaseWriter.cpp \
+    src/core/EmergencyProtocolLoader.cpp \
+    src/core/BatchExporter.cpp \
+    src/core/StallMonitor.cpp \
+    src/core/InteractionBenchmark.cpp \
+    src/core/AllocationCounter.cpp \
+    src/core/FootprintReport.cpp \
     src/models/Case.cpp \
     src/models/EmergencyScenario.cpp \
+    src/models/EmergencyScenarioRegistry.cpp \
+    src/models/TubeVocabulary.cpp \
     src/utils/ConfigManager.cpp \
     src/utils/StyleManager.cpp \
     src/utils/SATrachTube.cpp \
+    src/utils/DataFileWatcher.cpp \
+    src/utils/TubeCatalog.cpp \
+    src/utils/TubeEquivalence.cpp \
+    src/utils/SuctionRecommendations.cpp \
+    src/utils/CasePrintLayout.cpp \
     src/views/MainWindow.cpp \
     src/views/CaseSelectionView.cpp \
-    src/views/TracheostomyFormView.cpp \
-    src/views/NewTracheostomyFormView.cpp \
-    src/views/DifficultAirwayFormView.cpp \
-    src/views/LTRFormView.cpp \
     src/views/BaseDisplayView.cpp \
     src/views/TracheostomyDisplayView.cpp \
     src/views/NewTracheostomyDisplayView.cpp \
+    src/views/DifficultAirwayDisplayView.cpp \
+    src/views/LTRDisplayView.cpp \
+    src/views/KioskDisplayView.cpp \
+    src/views/WallDisplayView.cpp \
+    src/views/DisplayCardRenderer.cpp \
+    src/views/BatchExportDialog.cpp \
+    src/views/StallDiagnosticsDialog.cpp \
     src/widgets/BaseFormWidget.cpp \
-    src/widgets/EmergencyPanel.cpp \
+    src/widgets/FormSections.cpp \
+    src/widgets/FormValidator.cpp \
+    src/widgets/EmergencyOverlayService.cpp \
     src/widgets/EmergencyPanelOverlay.cpp \
     src/widgets/EscOverlayMenu.cpp \
     src/widgets/NotificationWidget.cpp \
@@ -35,22 +57,42 @@ SOURCES += \
 HEADERS += \
     src/core/Application.h \
     src/core/CaseManager.h \
+    src/core/AutoSaveScheduler.h \
+    src/core/CaseWriter.h \
+    src/core/EmergencyProtocolLoader.h \
+    src/core/BatchExporter.h \
+    src/core/StallMonitor.h \
+    src/core/InteractionBenchmark.h \
+    src/core/AllocationCounter.h \
+    src/core/FootprintReport.h \
     src/models/Case.h \
     src/models/EmergencyScenario.h \
+    src/models/EmergencyScenarioRegistry.h \
+    src/models/TubeVocabulary.h \
     src/utils/ConfigManager.h \
     src/utils/StyleManager.h \
     src/utils/SATrachTube.h \
+    src/utils/DataFileWatcher.h \
+    src/utils/TubeCatalog.h \
+    src/utils/TubeEquivalence.h \
+    src/utils/SuctionRecommendations.h \
+    src/utils/CasePrintLayout.h \
     src/views/MainWindow.h \
     src/views/CaseSelectionView.h \
-    src/views/TracheostomyFormView.h \
-    src/views/NewTracheostomyFormView.h \
-    src/views/DifficultAirwayFormView.h \
-    src/views/LTRFormView.h \
     src/views/BaseDisplayView.h \
     src/views/TracheostomyDisplayView.h \
     src/views/NewTracheostomyDisplayView.h \
+    src/views/DifficultAirwayDisplayView.h \
+    src/views/LTRDisplayView.h \
+    src/views/KioskDisplayView.h \
+    src/views/WallDisplayView.h \
+    src/views/DisplayCardRenderer.h \
+    src/views/BatchExportDialog.h \
+    src/views/StallDiagnosticsDialog.h \
     src/widgets/BaseFormWidget.h \
-    src/widgets/EmergencyPanel.h \
+    src/widgets/FormSections.h \
+    src/widgets/FormValidator.h \
+    src/widgets/EmergencyOverlayService.h \
     src/widgets/EmergencyPanelOverlay.h \
     src/widgets/EscOverlayMenu.h \
     src/widgets/NotificationWidget.h \
@@ -75,6 +117,9 @@ INCLUDEPATH += \
 
 DEFINES += QT_DEPRECATED_WARNINGS
 
+# qmake CONFIG+=count_allocations counts heap allocations for the benchmark mode
+count_allocations: DEFINES += SAFE_AIRWAY_COUNT_ALLOCATIONS
+
 qnx: target.path = /tmp/$${TARGET}/bin
 else: unix:!android: target.path = /opt/$${TARGET}/bin
 !isEmpty(target.path): INSTALLS += target
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+// Process-wide heap allocation count, for measuring how much a code path
+// allocates. Only active in builds configured with SAFE_AIRWAY_COUNT_ALLOCATIONS
+// (CMake option of the same name, or CONFIG+=count_allocations with qmake);
+// otherwise the count stays at zero.
+class AllocationCounter
+{
+public:
+    static bool isEnabled();
+
+    // Allocations made by all threads since startup
+    static quint64 count();
+
+private:
+    AllocationCounter() = delete;
+};
+
+#endif // ALLOCATIONCOUNTER_H
@@ -1,7 +1,10 @@
 #include "Application.h"
 #include "CaseManager.h"
+#include "EmergencyProtocolLoader.h"
+#include "StallMonitor.h"
 #include "utils/ConfigManager.h"
 #include "utils/StyleManager.h"
+#include "utils/TubeCatalog.h"
 #include <QStandardPaths>
 #include <QDir>
 
@@ -47,6 +50,8 @@ bool Application::initialize(QApplication* app)
 
 void Application::shutdown()
 {
+    StallMonitor::instance().stop();
+    
     if (caseManager_) {
         delete caseManager_;
         caseManager_ = nullptr;
@@ -61,6 +66,9 @@ void Application::initializeServices()
     
     caseManager_ = new CaseManager(this);
     caseManager_->initialize(safePath);
+
+    TubeCatalog::instance().load(safePath + "/tube_catalog.json");
+    EmergencyProtocolLoader::instance().load(safePath + "/emergency_protocols.json");
     
     ConfigManager::instance().saveFontSize(StyleManager::instance().getBaseFontSize());
 }
@@ -0,0 +1,84 @@
+#include "AutoSaveScheduler.h"
+
+AutoSaveScheduler::AutoSaveScheduler(QObject* parent)
+    : QObject(parent)
+    , idleTimer_(nullptr)
+    , maxDelayTimer_(nullptr)
+    , maxDelayMs_(0)
+    , dirty_(false)
+    , pendingWhilePaused_(false)
+    , pauseReasons_(0)
+{
+    idleTimer_ = new QTimer(this);
+    idleTimer_->setSingleShot(true);
+    idleTimer_->setInterval(IDLE_DELAY_MS);
+    connect(idleTimer_, &QTimer::timeout, this, &AutoSaveScheduler::onTimeout);
+
+    maxDelayTimer_ = new QTimer(this);
+    maxDelayTimer_->setSingleShot(true);
+    connect(maxDelayTimer_, &QTimer::timeout, this, &AutoSaveScheduler::onTimeout);
+}
+
+void AutoSaveScheduler::setMaxDelayMinutes(int minutes)
+{
+    maxDelayMs_ = qMax(0, minutes) * 60 * 1000;
+    maxDelayTimer_->setInterval(maxDelayMs_);
+    if (!isEnabled()) {
+        stopTimers();
+    }
+}
+
+void AutoSaveScheduler::markDirty()
+{
+    dirty_ = true;
+    if (!isEnabled()) return;
+
+    // Every keystroke pushes the save back; the max delay timer keeps running
+    idleTimer_->start();
+    if (!maxDelayTimer_->isActive()) {
+        maxDelayTimer_->start();
+    }
+}
+
+void AutoSaveScheduler::markSaved()
+{
+    dirty_ = false;
+    pendingWhilePaused_ = false;
+    stopTimers();
+}
+
+void AutoSaveScheduler::pause(PauseReason reason)
+{
+    pauseReasons_ |= reason;
+}
+
+void AutoSaveScheduler::resume(PauseReason reason)
+{
+    pauseReasons_ &= ~reason;
+    if (isPaused() || !pendingWhilePaused_) return;
+
+    // Give staff the same pause after the overlay or display closes
+    pendingWhilePaused_ = false;
+    if (dirty_ && isEnabled()) {
+        idleTimer_->start();
+    }
+}
+
+void AutoSaveScheduler::onTimeout()
+{
+    stopTimers();
+    if (!dirty_) return;
+
+    if (isPaused()) {
+        pendingWhilePaused_ = true;
+        return;
+    }
+
+    emit saveDue();
+}
+
+void AutoSaveScheduler::stopTimers()
+{
+    idleTimer_->stop();
+    maxDelayTimer_->stop();
+}
@@ -0,0 +1,59 @@
+#ifndef AUTOSAVESCHEDULER_H
+#define AUTOSAVESCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+
+// Decides when the open case is autosaved.
+//
+// Every edit restarts an idle timer, so a save waits for a pause in typing;
+// the configured autosave interval caps how long continuous editing can put
+// it off. saveDue() is only emitted while something is dirty and nothing has
+// paused autosave.
+class AutoSaveScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum PauseReason : quint32 {
+        DisplayModePause = 1u << 0,
+        EmergencyOverlayPause = 1u << 1
+    };
+
+    static constexpr int IDLE_DELAY_MS = 3000;
+
+    explicit AutoSaveScheduler(QObject* parent = nullptr);
+
+    // 0 minutes turns autosave off
+    void setMaxDelayMinutes(int minutes);
+    bool isEnabled() const { return maxDelayMs_ > 0; }
+
+    void markDirty();
+    bool isDirty() const { return dirty_; }
+
+    // The case was handed to the writer, or nothing is open
+    void markSaved();
+
+    // A save that comes due while paused waits for the last resume
+    void pause(PauseReason reason);
+    void resume(PauseReason reason);
+    bool isPaused() const { return pauseReasons_ != 0; }
+
+signals:
+    void saveDue();
+
+private slots:
+    void onTimeout();
+
+private:
+    QTimer* idleTimer_;
+    QTimer* maxDelayTimer_;
+    int maxDelayMs_;
+    bool dirty_;
+    bool pendingWhilePaused_;
+    quint32 pauseReasons_;
+
+    void stopTimers();
+};
+
+#endif // AUTOSAVESCHEDULER_H
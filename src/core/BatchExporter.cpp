@@ -0,0 +1,180 @@
+#include "BatchExporter.h"
+#include "CaseManager.h"
+#include "utils/CasePrintLayout.h"
+#include <QPainter>
+#include <QPdfWriter>
+#include <QPrinter>
+#include <QPageLayout>
+#include <QPageSize>
+#include <QFile>
+#include <QDate>
+#include <QtConcurrent>
+
+namespace {
+
+// Pages kept in flight per core; bounds memory regardless of selection size
+const int PAGES_PER_CORE = 2;
+
+struct LaidOutCase {
+    bool loaded = false;
+    bool included = false;
+    PrintPage page;
+};
+
+}
+
+BatchExporter::BatchExporter(QObject* parent)
+    : QObject(parent)
+    , workerThread_(nullptr)
+    , cancelled_(false)
+    , pagesWritten_(0)
+    , failedFiles_(0)
+{
+}
+
+BatchExporter::~BatchExporter()
+{
+    if (workerThread_) {
+        cancel();
+        workerThread_->wait();
+        delete workerThread_;
+    }
+}
+
+bool BatchExporter::exportPdf(const QStringList& filePaths, const CaseFilter& filter, const QString& pdfPath)
+{
+    return startWorker(filePaths, filter, pdfPath, nullptr);
+}
+
+bool BatchExporter::print(const QStringList& filePaths, const CaseFilter& filter, QPrinter* printer)
+{
+    return startWorker(filePaths, filter, QString(), printer);
+}
+
+void BatchExporter::cancel()
+{
+    cancelled_ = true;
+}
+
+BatchExporter::CaseFilter BatchExporter::updatedToday()
+{
+    const QDate today = QDate::currentDate();
+    return [today](const Case& case_) {
+        return case_.getUpdatedAt().date() == today;
+    };
+}
+
+bool BatchExporter::startWorker(const QStringList& filePaths, const CaseFilter& filter,
+                                const QString& pdfPath, QPrinter* printer)
+{
+    // The printer is owned by the job from here on
+    if (workerThread_) {
+        delete printer;
+        return false;
+    }
+
+    cancelled_ = false;
+    pagesWritten_ = 0;
+    failedFiles_ = 0;
+
+    workerThread_ = QThread::create([this, filePaths, filter, pdfPath, printer]() {
+        int pagesWritten = 0;
+        int failedFiles = 0;
+
+        if (printer) {
+            writePages(filePaths, filter, printer, pagesWritten, failedFiles);
+            delete printer;
+        } else {
+            {
+                QPdfWriter writer(pdfPath);
+                writer.setTitle("Safe Airway Cards");
+                writer.setCreator("Safe Airway");
+                writer.setResolution(300);
+                writer.setPageLayout(QPageLayout(QPageSize(QPageSize::Letter), QPageLayout::Landscape,
+                                                 QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter));
+                writePages(filePaths, filter, &writer, pagesWritten, failedFiles);
+            }
+
+            // Nothing matched: do not leave an empty document behind
+            if (pagesWritten == 0) {
+                QFile::remove(pdfPath);
+            }
+        }
+
+        pagesWritten_ = pagesWritten;
+        failedFiles_ = failedFiles;
+    });
+
+    connect(workerThread_, &QThread::finished, this, &BatchExporter::onWorkerFinished);
+    workerThread_->start();
+    return true;
+}
+
+void BatchExporter::writePages(const QStringList& filePaths, const CaseFilter& filter,
+                               QPagedPaintDevice* device, int& pagesWritten, int& failedFiles)
+{
+    const int total = filePaths.size();
+    const int chunkSize = qMax(1, QThread::idealThreadCount() * PAGES_PER_CORE);
+    const QRectF pageRect(QPointF(0, 0),
+                          device->pageLayout().paintRectPixels(device->logicalDpiX()).size());
+
+    QPainter painter;
+
+    for (int start = 0; start < total && !cancelled_; start += chunkSize) {
+        const QStringList chunk = filePaths.mid(start, chunkSize);
+
+        // Parse and lay out in parallel; results come back in input order
+        const QList<LaidOutCase> results = QtConcurrent::blockingMapped<QList<LaidOutCase>>(chunk,
+            [&filter](const QString& filePath) {
+                LaidOutCase result;
+                Case loaded;
+                result.loaded = CaseManager::readCaseFile(filePath, loaded);
+                result.included = result.loaded && (!filter || filter(loaded));
+                if (result.included) {
+                    result.page = CasePrintLayout::layoutCase(loaded);
+                }
+                return result;
+            });
+
+        // Painting stays sequential; the device writes each page out as it goes
+        for (const LaidOutCase& result : results) {
+            if (!result.loaded) {
+                ++failedFiles;
+                continue;
+            }
+            if (!result.included) {
+                continue;
+            }
+
+            if (pagesWritten == 0) {
+                if (!painter.begin(device)) {
+                    emit error("Unable to open the output for writing");
+                    cancelled_ = true;
+                    return;
+                }
+            } else {
+                device->newPage();
+            }
+
+            CasePrintLayout::paintPage(&painter, result.page, pageRect);
+            ++pagesWritten;
+        }
+
+        emit progress(qMin(start + chunkSize, total), total);
+    }
+
+    if (painter.isActive()) {
+        painter.end();
+    }
+}
+
+void BatchExporter::onWorkerFinished()
+{
+    QThread* thread = workerThread_;
+    workerThread_ = nullptr;
+    if (thread) {
+        thread->deleteLater();
+    }
+
+    emit finished(pagesWritten_, failedFiles_, cancelled_);
+}
@@ -0,0 +1,59 @@
+#ifndef BATCHEXPORTER_H
+#define BATCHEXPORTER_H
+
+#include <QObject>
+#include <QStringList>
+#include <QThread>
+#include <atomic>
+#include <functional>
+#include "models/Case.h"
+
+class QPrinter;
+class QPagedPaintDevice;
+
+// Prints or exports a whole selection of saved cases as one document.
+// Case files are parsed and laid out in parallel a chunk at a time, and each
+// chunk is streamed to the output before the next one is started, so memory
+// stays bounded no matter how many cases are selected.
+class BatchExporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    typedef std::function<bool(const Case&)> CaseFilter;
+
+    explicit BatchExporter(QObject* parent = nullptr);
+    ~BatchExporter();
+
+    // Both return false if a job is already running
+    bool exportPdf(const QStringList& filePaths, const CaseFilter& filter, const QString& pdfPath);
+    bool print(const QStringList& filePaths, const CaseFilter& filter, QPrinter* printer);
+
+    void cancel();
+    bool isRunning() const { return workerThread_ != nullptr; }
+
+    static CaseFilter updatedToday();
+
+signals:
+    void progress(int processed, int total);
+    void finished(int pagesWritten, int failedFiles, bool cancelled);
+    void error(const QString& message);
+
+private slots:
+    void onWorkerFinished();
+
+private:
+    QThread* workerThread_;
+    std::atomic<bool> cancelled_;
+
+    // Written by the worker, read once its thread has finished
+    int pagesWritten_;
+    int failedFiles_;
+
+    bool startWorker(const QStringList& filePaths, const CaseFilter& filter,
+                     const QString& pdfPath, QPrinter* printer);
+    void writePages(const QStringList& filePaths, const CaseFilter& filter,
+                    QPagedPaintDevice* device, int& pagesWritten, int& failedFiles);
+};
+
+#endif // BATCHEXPORTER_H
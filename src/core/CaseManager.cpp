@@ -1,22 +1,24 @@
 #include "CaseManager.h"
+#include "StallMonitor.h"
+#include "CaseWriter.h"
 #include "utils/ConfigManager.h"
 #include <QDir>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QDateTime>
+#include <QFileInfo>
 #include <QStandardPaths>
 
 CaseManager::CaseManager(QObject* parent)
     : QObject(parent)
-    , autoSaveEnabled_(true)
-    , autoSaveInterval_(5)
-    , autoSaveTimer_(nullptr)
+    , writer_(nullptr)
     , fileWatcher_(nullptr)
 {
-    autoSaveTimer_ = new QTimer(this);
-    autoSaveTimer_->setSingleShot(false);
-    connect(autoSaveTimer_, &QTimer::timeout, this, &CaseManager::onAutoSaveTimer);
-    
+    writer_ = new CaseWriter(this);
+    connect(writer_, &CaseWriter::written, this, &CaseManager::onCaseWritten);
+    connect(writer_, &CaseWriter::failed, this, &CaseManager::onCaseWriteFailed);
+    connect(writer_, &CaseWriter::drained, this, &CaseManager::writesFinished);
+
     fileWatcher_ = new QFileSystemWatcher(this);
     connect(fileWatcher_, &QFileSystemWatcher::directoryChanged, this, &CaseManager::onDirectoryChanged);
     connect(fileWatcher_, &QFileSystemWatcher::fileChanged, this, &CaseManager::onFileChanged);
@@ -36,10 +38,6 @@ bool CaseManager::initialize(const QString& basePath)
     
     fileWatcher_->addPath(basePath_);
     
-    if (autoSaveEnabled_) {
-        autoSaveTimer_->start(autoSaveInterval_ * 60 * 1000);
-    }
-    
     return true;
 }
 
@@ -65,44 +63,46 @@ void CaseManager::createDirectoryStructure()
     }
 }
 
-QString CaseManager::saveCase(const Case& case_)
+QString CaseManager::saveCase(const Case& case_, quint64* generation)
 {
-    QString filePath;
-
-    // Check if this is an existing case with a known file path
-    QString existingPath = case_.getFilePath();
-    if (!existingPath.isEmpty() && QFile::exists(existingPath)) {
-        // Use existing file path to overwrite
-        filePath = existingPath;
-    } else {
-        // Generate new filename for new cases
-        QString filename = generateCaseFilename(case_);
-        QString typeDir = getCaseTypeDirectory(case_.getCaseType());
-        filePath = typeDir + "/" + filename;
-    }
+    StallMonitor::Scope scope("CaseManager::saveCase");
+    const QString filePath = targetFilePath(case_);
+    const quint64 queued = writer_->enqueue(case_, filePath, CaseWriter::Save);
+    if (generation) *generation = queued;
+    return filePath;
+}
 
-    QJsonDocument doc(case_.toJson());
+QString CaseManager::autoSaveCase(const Case& case_, quint64* generation)
+{
+    StallMonitor::Scope scope("CaseManager::autoSaveCase");
+    const QString filePath = targetFilePath(case_);
+    const quint64 queued = writer_->enqueue(case_, filePath, CaseWriter::AutoSave);
+    if (generation) *generation = queued;
+    return filePath;
+}
 
-    QFile file(filePath);
-    if (!file.open(QIODevice::WriteOnly)) {
-        emit error("Failed to save case: " + file.errorString());
-        return QString();
+bool CaseManager::loadCase(const QString& filePath, Case& case_)
+{
+    QString errorMessage;
+    if (!readCaseFile(filePath, case_, &errorMessage)) {
+        emit error(errorMessage);
+        return false;
     }
 
-    file.write(doc.toJson());
-    file.close();
-
     updateRecentCases(filePath);
 
-    emit caseSaved(filePath);
-    return filePath;
+    // Lets an autosave of the untouched case skip the write
+    writer_->enqueue(case_, filePath, CaseWriter::Baseline);
+
+    emit caseLoaded(filePath);
+    return true;
 }
 
-bool CaseManager::loadCase(const QString& filePath, Case& case_)
+bool CaseManager::readCaseFile(const QString& filePath, Case& case_, QString* errorMessage)
 {
     QFile file(filePath);
     if (!file.open(QIODevice::ReadOnly)) {
-        emit error("Failed to load case: " + file.errorString());
+        if (errorMessage) *errorMessage = "Failed to load case: " + file.errorString();
         return false;
     }
     
@@ -111,16 +111,12 @@ bool CaseManager::loadCase(const QString& filePath, Case& case_)
     
     QJsonDocument doc = QJsonDocument::fromJson(data);
     if (doc.isNull()) {
-        emit error("Failed to parse case file: " + filePath);
+        if (errorMessage) *errorMessage = "Failed to parse case file: " + filePath;
         return false;
     }
     
     case_ = Case::fromJson(doc.object());
     case_.setFilePath(filePath);  // Set the file path after loading
-
-    updateRecentCases(filePath);
-
-    emit caseLoaded(filePath);
     return true;
 }
 
@@ -172,45 +168,25 @@ QStringList CaseManager::getAllCases() const
     return allCases;
 }
 
-bool CaseManager::exportCase(const Case& case_, const QString& filePath)
+bool CaseManager::exportCase(const Case& case_, const QString& filePath, quint64* generation)
 {
-    QJsonDocument doc(case_.toJson());
-    
-    QFile file(filePath);
-    if (!file.open(QIODevice::WriteOnly)) {
-        emit error("Failed to export case: " + file.errorString());
+    if (filePath.isEmpty()) {
         return false;
     }
-    
-    file.write(doc.toJson(QJsonDocument::Indented));
-    file.close();
-    
-    return true;
-}
 
-bool CaseManager::importCase(const QString& filePath, Case& case_)
-{
-    return loadCase(filePath, case_);
+    const quint64 queued = writer_->enqueue(case_, filePath, CaseWriter::Export);
+    if (generation) *generation = queued;
+    return true;
 }
 
-void CaseManager::setAutoSaveEnabled(bool enabled)
+int CaseManager::pendingWrites() const
 {
-    autoSaveEnabled_ = enabled;
-    
-    if (enabled) {
-        autoSaveTimer_->start(autoSaveInterval_ * 60 * 1000);
-    } else {
-        autoSaveTimer_->stop();
-    }
+    return writer_->pendingWrites();
 }
 
-void CaseManager::setAutoSaveInterval(int minutes)
+bool CaseManager::importCase(const QString& filePath, Case& case_)
 {
-    autoSaveInterval_ = minutes;
-    
-    if (autoSaveEnabled_) {
-        autoSaveTimer_->start(autoSaveInterval_ * 60 * 1000);
-    }
+    return loadCase(filePath, case_);
 }
 
 QString CaseManager::getCaseDirectory(CaseType caseType) const
@@ -226,6 +202,17 @@ QString CaseManager::generateCaseFilename(const Case& case_) const
     return QString("%1.json").arg(id);
 }
 
+QString CaseManager::targetFilePath(const Case& case_) const
+{
+    // A saved case keeps its own file; a new one gets one by ID. Nothing is
+    // checked on disk here; the writer recreates a missing file or directory.
+    QString existingPath = case_.getFilePath();
+    if (!existingPath.isEmpty()) {
+        return existingPath;
+    }
+    return getCaseTypeDirectory(case_.getCaseType()) + "/" + generateCaseFilename(case_);
+}
+
 QString CaseManager::getCaseTypeDirectory(CaseType caseType) const
 {
     QString typeString;
@@ -262,19 +249,97 @@ void CaseManager::updateRecentCases(const QString& filePath)
     ConfigManager::instance().saveRecentCases(recentCases);
 }
 
-void CaseManager::onAutoSaveTimer()
+void CaseManager::onCaseWritten(const QString& filePath, quint64 generation, int purpose, bool unchanged)
+{
+    Q_UNUSED(generation);
+
+    switch (purpose) {
+    case CaseWriter::Save:
+        updateRecentCases(filePath);
+        emit caseSaved(filePath);
+        break;
+    case CaseWriter::AutoSave:
+        if (!unchanged) {
+            updateRecentCases(filePath);
+        }
+        emit autoSaveCompleted(filePath);
+        break;
+    case CaseWriter::Export:
+        emit caseExported(filePath);
+        break;
+    default:
+        break;
+    }
+}
+
+void CaseManager::onCaseWriteFailed(const QString& filePath, quint64 generation, int purpose, const QString& message)
+{
+    switch (purpose) {
+    case CaseWriter::Save:
+        emit saveFailed(filePath, generation, "Failed to save case: " + message, false);
+        break;
+    case CaseWriter::AutoSave:
+        emit saveFailed(filePath, generation, "Failed to auto-save case: " + message, true);
+        break;
+    default:
+        emit saveFailed(filePath, generation, "Failed to save case as: " + message, false);
+        break;
+    }
+}
+
+void CaseManager::watchCaseFile(const QString& filePath)
+{
+    QString path = QFileInfo(filePath).absoluteFilePath();
+    if (watchedCaseFiles_[path]++ > 0) {
+        return;
+    }
+    if (QFileInfo::exists(path)) {
+        fileWatcher_->addPath(path);
+    }
+
+    // Saves replace the file, so also watch its directory to pick it up again
+    fileWatcher_->addPath(QFileInfo(path).absolutePath());
+}
+
+void CaseManager::unwatchCaseFile(const QString& filePath)
 {
-    emit autoSaveCompleted(QString());
+    QString path = QFileInfo(filePath).absoluteFilePath();
+    auto it = watchedCaseFiles_.find(path);
+    if (it == watchedCaseFiles_.end()) {
+        return;
+    }
+    if (--it.value() == 0) {
+        watchedCaseFiles_.erase(it);
+        fileWatcher_->removePath(path);
+    }
 }
 
 void CaseManager::onDirectoryChanged(const QString& path)
 {
-    Q_UNUSED(path)
+    StallMonitor::Scope scope("CaseManager::onDirectoryChanged");
+    // A watched file that was replaced drops out of the watcher; re-add it
+    const QStringList watchedFiles = fileWatcher_->files();
+    for (auto it = watchedCaseFiles_.cbegin(); it != watchedCaseFiles_.cend(); ++it) {
+        const QString& filePath = it.key();
+        if (QFileInfo(filePath).absolutePath() != path) continue;
+        if (QFileInfo::exists(filePath) && !watchedFiles.contains(filePath)) {
+            fileWatcher_->addPath(filePath);
+            emit caseFileChanged(filePath);
+        }
+    }
+
     emit casesChanged();
 }
 
 void CaseManager::onFileChanged(const QString& path)
 {
-    Q_UNUSED(path)
+    StallMonitor::Scope scope("CaseManager::onFileChanged");
+    if (watchedCaseFiles_.contains(path)) {
+        if (QFileInfo::exists(path) && !fileWatcher_->files().contains(path)) {
+            fileWatcher_->addPath(path);
+        }
+        emit caseFileChanged(path);
+    }
+
     emit casesChanged();
 }
\ No newline at end of file
@@ -2,10 +2,12 @@
 #define CASEMANAGER_H
 
 #include <QObject>
-#include <QTimer>
 #include <QFileSystemWatcher>
+#include <QHash>
 #include "models/Case.h"
 
+class CaseWriter;
+
 class CaseManager : public QObject
 {
     Q_OBJECT
@@ -15,51 +17,66 @@ public:
     
     bool initialize(const QString& basePath);
     
-    QString saveCase(const Case& case_);
+    // Both queue the case for the writer thread and return its file path at
+    // once; caseSaved, autoSaveCompleted or saveFailed reports the outcome.
+    // The generation tells a failed write apart from newer ones of the file.
+    QString saveCase(const Case& case_, quint64* generation = nullptr);
+    // Skipped when the content is unchanged since the file was last written or read
+    QString autoSaveCase(const Case& case_, quint64* generation = nullptr);
     bool loadCase(const QString& filePath, Case& case_);
+    
+    // Reads a case file without side effects; safe to call from worker threads
+    static bool readCaseFile(const QString& filePath, Case& case_, QString* errorMessage = nullptr);
     bool deleteCase(const QString& filePath);
     
     QStringList getRecentCases() const;
     QStringList getCasesByType(CaseType caseType) const;
     QStringList getAllCases() const;
     
-    bool exportCase(const Case& case_, const QString& filePath);
+    // Queued like a save; caseExported or saveFailed reports the outcome
+    bool exportCase(const Case& case_, const QString& filePath, quint64* generation = nullptr);
     bool importCase(const QString& filePath, Case& case_);
     
-    void setAutoSaveEnabled(bool enabled);
-    bool isAutoSaveEnabled() const { return autoSaveEnabled_; }
-    
-    void setAutoSaveInterval(int minutes);
-    int getAutoSaveInterval() const { return autoSaveInterval_; }
+    // Saves, autosaves and exports not yet written; writesFinished follows
+    // the outcome of the last of them
+    int pendingWrites() const;
     
     QString getBasePath() const { return basePath_; }
     QString getCaseDirectory(CaseType caseType) const;
     
+    // Emits caseFileChanged whenever the file is rewritten or replaced.
+    // Watches are counted, so each watch needs a matching unwatch.
+    void watchCaseFile(const QString& filePath);
+    void unwatchCaseFile(const QString& filePath);
+    
 signals:
     void caseSaved(const QString& filePath);
+    void caseExported(const QString& filePath);
     void caseLoaded(const QString& filePath);
     void caseDeleted(const QString& filePath);
     void casesChanged();
+    void caseFileChanged(const QString& filePath);
     void autoSaveCompleted(const QString& filePath);
+    void saveFailed(const QString& filePath, quint64 generation, const QString& message, bool autoSave);
+    void writesFinished();
     void error(const QString& message);
 
-public slots:
-    void onAutoSaveTimer();
-    
 private:
     QString basePath_;
-    bool autoSaveEnabled_;
-    int autoSaveInterval_;
-    QTimer* autoSaveTimer_;
+    CaseWriter* writer_;
     QFileSystemWatcher* fileWatcher_;
+    QHash<QString, int> watchedCaseFiles_;
     
     void createDirectoryStructure();
     QString generateCaseFilename(const Case& case_) const;
+    QString targetFilePath(const Case& case_) const;
     QString getCaseTypeDirectory(CaseType caseType) const;
     
     void updateRecentCases(const QString& filePath);
     
 private slots:
+    void onCaseWritten(const QString& filePath, quint64 generation, int purpose, bool unchanged);
+    void onCaseWriteFailed(const QString& filePath, quint64 generation, int purpose, const QString& message);
     void onDirectoryChanged(const QString& path);
     void onFileChanged(const QString& path);
 };
@@ -0,0 +1,159 @@
+#include "CaseWriter.h"
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDir>
+
+CaseWriter::CaseWriter(QObject* parent)
+    : QObject(parent)
+    , writerThread_(nullptr)
+    , pendingWrites_(0)
+    , nextGeneration_(1)
+    , stopping_(false)
+{
+    writerThread_ = QThread::create([this]() { run(); });
+    writerThread_->setObjectName("CaseWriter");
+    writerThread_->start();
+}
+
+CaseWriter::~CaseWriter()
+{
+    {
+        QMutexLocker locker(&mutex_);
+        stopping_ = true;
+        jobQueued_.wakeAll();
+    }
+    writerThread_->wait();
+    delete writerThread_;
+}
+
+quint64 CaseWriter::enqueue(const Case& snapshot, const QString& filePath, Purpose purpose)
+{
+    Job dropped;
+    const quint64 generation = enqueueLocked(snapshot, filePath, purpose, &dropped);
+
+    // Reported like a failed write, so its case counts as unsaved again
+    if (dropped.purpose == AutoSave) {
+        emit failed(dropped.filePath, dropped.generation, dropped.purpose, "too many writes queued");
+        if (pendingWrites() == 0) {
+            emit drained();
+        }
+    }
+    return generation;
+}
+
+quint64 CaseWriter::enqueueLocked(const Case& snapshot, const QString& filePath, Purpose purpose, Job* dropped)
+{
+    QMutexLocker locker(&mutex_);
+    const quint64 generation = nextGeneration_++;
+
+    // A queued write of the same file only ever needs the newest snapshot,
+    // and a queued baseline only the newest read
+    for (Job& job : queue_) {
+        if (job.filePath == filePath && (job.purpose == Baseline) == (purpose == Baseline)) {
+            job.snapshot = snapshot;
+            job.generation = generation;
+            job.purpose = qMax(job.purpose, purpose);
+            return generation;
+        }
+    }
+
+    if (queue_.size() >= MAX_QUEUED && !dropOldest(Baseline, dropped) && !dropOldest(AutoSave, dropped)) {
+        // Saves the user asked for are never dropped, so the queue may go over
+        qWarning("Case writer queue holds %d saves", int(queue_.size()));
+    }
+
+    Job job;
+    job.snapshot = snapshot;
+    job.filePath = filePath;
+    job.generation = generation;
+    job.purpose = purpose;
+    queue_.append(job);
+    if (purpose != Baseline) {
+        ++pendingWrites_;
+    }
+    jobQueued_.wakeOne();
+    return generation;
+}
+
+int CaseWriter::pendingWrites() const
+{
+    QMutexLocker locker(&mutex_);
+    return pendingWrites_;
+}
+
+bool CaseWriter::dropOldest(Purpose purpose, Job* dropped)
+{
+    for (int i = 0; i < queue_.size(); ++i) {
+        if (queue_.at(i).purpose != purpose) continue;
+
+        *dropped = queue_.takeAt(i);
+        if (purpose != Baseline) {
+            --pendingWrites_;
+        }
+        return true;
+    }
+    return false;
+}
+
+void CaseWriter::run()
+{
+    forever {
+        Job job;
+        {
+            QMutexLocker locker(&mutex_);
+            while (queue_.isEmpty() && !stopping_) {
+                jobQueued_.wait(&mutex_);
+            }
+            // Stopping drains the queue first
+            if (queue_.isEmpty()) return;
+            job = queue_.takeFirst();
+        }
+        process(job);
+
+        if (job.purpose != Baseline) {
+            QMutexLocker locker(&mutex_);
+            if (--pendingWrites_ == 0) {
+                emit drained();
+            }
+        }
+    }
+}
+
+void CaseWriter::process(const Job& job)
+{
+    const QJsonObject json = job.snapshot.toJson();
+
+    // Every edit moves updatedAt, so it is left out of the content hash
+    QJsonObject content = json;
+    content.remove("updatedAt");
+    const QByteArray contentHash = QCryptographicHash::hash(
+        QJsonDocument(content).toJson(QJsonDocument::Compact), QCryptographicHash::Sha1);
+
+    if (job.purpose == Baseline) {
+        contentHashes_.insert(job.filePath, contentHash);
+        return;
+    }
+    if (job.purpose == AutoSave && contentHashes_.value(job.filePath) == contentHash) {
+        emit written(job.filePath, job.generation, job.purpose, true);
+        return;
+    }
+
+    // The file or its directory may have been removed since the case was opened
+    const QString directory = QFileInfo(job.filePath).absolutePath();
+    if (!QFileInfo::exists(directory)) {
+        QDir().mkpath(directory);
+    }
+
+    QSaveFile file(job.filePath);
+    const QByteArray data = QJsonDocument(json).toJson(QJsonDocument::Indented);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        emit failed(job.filePath, job.generation, job.purpose, file.errorString());
+        return;
+    }
+
+    contentHashes_.insert(job.filePath, contentHash);
+    emit written(job.filePath, job.generation, job.purpose, false);
+}
@@ -0,0 +1,78 @@
+#ifndef CASEWRITER_H
+#define CASEWRITER_H
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QList>
+#include <QHash>
+#include "models/Case.h"
+
+// Serializes and writes case files on a dedicated thread.
+//
+// The GUI thread only queues a Case, which is an implicitly shared snapshot,
+// so the form can keep editing its own copy. Another write of the same file
+// that is still queued is replaced in place by the newer snapshot, and each
+// file is replaced atomically with QSaveFile. The queue is bounded and never
+// blocks the caller: when it is full, the oldest queued autosave or baseline
+// is dropped to make room.
+class CaseWriter : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Ordered so a coalesced write keeps the stronger purpose
+    enum Purpose {
+        AutoSave = 0,   // skipped when the content matches the last write
+        Save,
+        Export,
+        Baseline        // records the content of a file just read; writes nothing
+    };
+
+    static constexpr int MAX_QUEUED = 16;
+
+    explicit CaseWriter(QObject* parent = nullptr);
+    // Finishes every queued write before returning
+    ~CaseWriter();
+
+    // Returns the write's generation; generations only ever increase
+    quint64 enqueue(const Case& snapshot, const QString& filePath, Purpose purpose);
+
+    // Writes queued or in progress; baselines are not counted
+    int pendingWrites() const;
+
+signals:
+    // Emitted from the writer thread, or from enqueue() for an autosave it
+    // dropped; purpose is a Purpose
+    void written(const QString& filePath, quint64 generation, int purpose, bool unchanged);
+    void failed(const QString& filePath, quint64 generation, int purpose, const QString& message);
+    // The last pending write has reported its outcome
+    void drained();
+
+private:
+    struct Job {
+        Case snapshot;
+        QString filePath;
+        quint64 generation = 0;
+        Purpose purpose = Save;
+    };
+
+    QThread* writerThread_;
+    mutable QMutex mutex_;
+    QWaitCondition jobQueued_;
+    QList<Job> queue_;
+    int pendingWrites_;
+    quint64 nextGeneration_;
+    bool stopping_;
+
+    // Writer thread only: content hash of each file as last written or read
+    QHash<QString, QByteArray> contentHashes_;
+
+    quint64 enqueueLocked(const Case& snapshot, const QString& filePath, Purpose purpose, Job* dropped);
+    bool dropOldest(Purpose purpose, Job* dropped);
+    void run();
+    void process(const Job& job);
+};
+
+#endif // CASEWRITER_H
@@ -0,0 +1,108 @@
+#include "EmergencyProtocolLoader.h"
+#include "utils/DataFileWatcher.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QtConcurrent>
+
+EmergencyProtocolLoader* EmergencyProtocolLoader::instance_ = nullptr;
+
+EmergencyProtocolLoader& EmergencyProtocolLoader::instance()
+{
+    if (!instance_) {
+        instance_ = new EmergencyProtocolLoader();
+    }
+    return *instance_;
+}
+
+EmergencyProtocolLoader::EmergencyProtocolLoader()
+    : QObject(nullptr)
+    , watcher_(nullptr)
+    , loadWatcher_(nullptr)
+    , reloadPending_(false)
+{
+    watcher_ = new DataFileWatcher(this);
+    connect(watcher_, &DataFileWatcher::changed, this, &EmergencyProtocolLoader::reload);
+
+    loadWatcher_ = new QFutureWatcher<LoadResult>(this);
+    connect(loadWatcher_, &QFutureWatcher<LoadResult>::finished, this, &EmergencyProtocolLoader::onLoadFinished);
+}
+
+void EmergencyProtocolLoader::load(const QString& filePath)
+{
+    filePath_ = filePath;
+    loadedData_.clear();
+    watcher_->setFilePath(filePath_);
+    reload();
+}
+
+void EmergencyProtocolLoader::reload()
+{
+    if (filePath_.isEmpty()) return;
+
+    // One load at a time; a change during a load is picked up afterwards
+    if (loadWatcher_->isRunning()) {
+        reloadPending_ = true;
+        return;
+    }
+
+    loadWatcher_->setFuture(QtConcurrent::run(&EmergencyProtocolLoader::readFile, filePath_, loadedData_));
+}
+
+EmergencyProtocolLoader::LoadResult EmergencyProtocolLoader::readFile(const QString& filePath,
+                                                                      const QByteArray& loadedData)
+{
+    LoadResult result;
+
+    QFile file(filePath);
+    if (!QFileInfo::exists(filePath)) {
+        result.missing = true;
+        return result;
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        result.errorMessage = "Unable to read emergency protocols: " + filePath;
+        return result;
+    }
+
+    result.data = file.readAll();
+    if (result.data == loadedData) {
+        return result; // Unchanged
+    }
+
+    QString errorMessage;
+    std::unique_ptr<EmergencyScenarioRegistry> registry = EmergencyScenarioRegistry::fromJson(result.data, errorMessage);
+    if (!registry) {
+        result.errorMessage = QString("Emergency protocols %1 were not loaded: %2")
+                                  .arg(QFileInfo(filePath).fileName(), errorMessage);
+        return result;
+    }
+    result.registry = std::move(registry);
+    return result;
+}
+
+void EmergencyProtocolLoader::onLoadFinished()
+{
+    const LoadResult result = loadWatcher_->result();
+
+    if (result.missing) {
+        // Removing the file goes back to the built-in protocols
+        if (!loadedData_.isEmpty()) {
+            loadedData_.clear();
+            EmergencyScenarioRegistry::publish(nullptr);
+            emit protocolsChanged();
+        }
+    } else if (!result.errorMessage.isEmpty()) {
+        // Keep serving the last good protocols
+        qWarning("%s", qPrintable(result.errorMessage));
+        emit error(result.errorMessage);
+    } else if (result.registry) {
+        loadedData_ = result.data;
+        registries_.push_back(result.registry);
+        EmergencyScenarioRegistry::publish(result.registry.get());
+        emit protocolsChanged();
+    }
+
+    if (reloadPending_) {
+        reloadPending_ = false;
+        reload();
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef EMERGENCYPROTOCOLLOADER_H
+#define EMERGENCYPROTOCOLLOADER_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QFutureWatcher>
+#include <memory>
+#include <vector>
+#include "models/EmergencyScenarioRegistry.h"
+
+class DataFileWatcher;
+
+// Keeps EmergencyScenarioRegistry in step with emergency_protocols.json.
+// The file is read and compiled on a worker thread and the finished set is
+// published with one pointer swap, so the emergency overlay never waits on
+// the disk. An invalid file is reported and the current set stays in use;
+// a missing file means the built-in protocols.
+class EmergencyProtocolLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    static EmergencyProtocolLoader& instance();
+
+    void load(const QString& filePath);
+    QString filePath() const { return filePath_; }
+
+signals:
+    void protocolsChanged();
+    void error(const QString& message);
+
+private slots:
+    void reload();
+    void onLoadFinished();
+
+private:
+    struct LoadResult {
+        bool missing = false;
+        QByteArray data;
+        std::shared_ptr<const EmergencyScenarioRegistry> registry;
+        QString errorMessage;
+    };
+
+    EmergencyProtocolLoader();
+    EmergencyProtocolLoader(const EmergencyProtocolLoader&) = delete;
+    EmergencyProtocolLoader& operator=(const EmergencyProtocolLoader&) = delete;
+
+    static LoadResult readFile(const QString& filePath, const QByteArray& loadedData);
+
+    static EmergencyProtocolLoader* instance_;
+
+    QString filePath_;
+    QByteArray loadedData_;
+    DataFileWatcher* watcher_;
+    QFutureWatcher<LoadResult>* loadWatcher_;
+    bool reloadPending_;
+
+    // Published sets stay alive; readers may still hold a replaced one
+    std::vector<std::shared_ptr<const EmergencyScenarioRegistry>> registries_;
+};
+
+#endif // EMERGENCYPROTOCOLLOADER_H
@@ -0,0 +1,224 @@
+#include "FootprintReport.h"
+#include <QWidget>
+#include <QStackedWidget>
+#include <QLabel>
+#include <QPixmap>
+#include <QBackingStore>
+#include <QGuiApplication>
+#include <QFile>
+#include <QTextStream>
+#include <QMap>
+#include <QList>
+#include <QtGlobal>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_MACOS)
+#include <mach/mach.h>
+#elif defined(Q_OS_LINUX)
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+namespace {
+
+struct BuildSample {
+    QString viewName;
+    qint64 before = -1;
+    qint64 after = -1;
+};
+
+// Views built so far, in construction order
+QList<BuildSample>& buildSamples()
+{
+    static QList<BuildSample> samples;
+    return samples;
+}
+
+struct TreeFootprint {
+    int objects = 0;
+    int widgets = 0;
+    int styleSheets = 0;
+    qint64 styleSheetChars = 0;
+    int pixmaps = 0;
+    qint64 pixmapBytes = 0;
+    int backingStores = 0;
+    qint64 backingStoreBytes = 0;
+    QMap<QString, int> classes;
+};
+
+qint64 pixmapBytes(const QPixmap& pixmap)
+{
+    return qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+}
+
+// Counts object and its descendants, leaving out the subtrees in skip
+void measureTree(const QObject* object, const QList<const QObject*>& skip, TreeFootprint& footprint)
+{
+    ++footprint.objects;
+    footprint.classes[QString::fromLatin1(object->metaObject()->className())]++;
+
+    if (object->isWidgetType()) {
+        const QWidget* widget = static_cast<const QWidget*>(object);
+        ++footprint.widgets;
+
+        if (!widget->styleSheet().isEmpty()) {
+            ++footprint.styleSheets;
+            footprint.styleSheetChars += widget->styleSheet().size();
+        }
+
+        if (const QLabel* label = qobject_cast<const QLabel*>(widget)) {
+            const QPixmap pixmap = label->pixmap();
+            if (!pixmap.isNull()) {
+                ++footprint.pixmaps;
+                footprint.pixmapBytes += pixmapBytes(pixmap);
+            }
+        }
+
+        // Only windows own a backing store; assumes 32 bits per pixel
+        if (widget->isWindow() && widget->backingStore()) {
+            const QSize size = widget->backingStore()->size() * widget->devicePixelRatioF();
+            ++footprint.backingStores;
+            footprint.backingStoreBytes += qint64(size.width()) * size.height() * 4;
+        }
+    }
+
+    for (const QObject* child : object->children()) {
+        if (!skip.contains(child)) {
+            measureTree(child, skip, footprint);
+        }
+    }
+}
+
+QString kilobytes(qint64 bytes)
+{
+    return bytes < 0 ? QString("n/a") : QString::number((bytes + 512) / 1024);
+}
+
+void writeSection(QTextStream& out, const QString& name, const TreeFootprint& footprint)
+{
+    out << "\n[" << name << "]\n";
+    out << QString("%1 %2\n").arg("objects", -24).arg(footprint.objects, 10);
+    out << QString("%1 %2\n").arg("widgets", -24).arg(footprint.widgets, 10);
+    out << QString("%1 %2\n").arg("style sheets", -24).arg(footprint.styleSheets, 10);
+    out << QString("%1 %2\n").arg("style sheet chars", -24).arg(footprint.styleSheetChars, 10);
+    out << QString("%1 %2\n").arg("pixmaps", -24).arg(footprint.pixmaps, 10);
+    out << QString("%1 %2\n").arg("pixmap KB", -24).arg(kilobytes(footprint.pixmapBytes), 10);
+    out << QString("%1 %2\n").arg("backing stores", -24).arg(footprint.backingStores, 10);
+    out << QString("%1 %2\n").arg("backing store KB", -24).arg(kilobytes(footprint.backingStoreBytes), 10);
+
+    // QMap keeps the classes sorted by name
+    for (auto it = footprint.classes.constBegin(); it != footprint.classes.constEnd(); ++it) {
+        out << QString("  %1 %2\n").arg(it.key(), -38).arg(it.value(), 8);
+    }
+}
+
+} // namespace
+
+FootprintReport::BuildScope::BuildScope(const char* viewName)
+    : viewName_(viewName)
+    , residentBefore_(FootprintReport::residentBytes())
+{
+}
+
+FootprintReport::BuildScope::~BuildScope()
+{
+    BuildSample sample;
+    sample.viewName = QString::fromLatin1(viewName_);
+    sample.before = residentBefore_;
+    sample.after = FootprintReport::residentBytes();
+    buildSamples().append(sample);
+}
+
+qint64 FootprintReport::residentBytes()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return qint64(counters.WorkingSetSize);
+    }
+    return -1;
+#elif defined(Q_OS_MACOS)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return qint64(info.resident_size);
+    }
+    return -1;
+#elif defined(Q_OS_LINUX)
+    // statm is in pages: total size, then resident
+    long pages = 0;
+    long resident = 0;
+    FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (!statm) return -1;
+    const int fields = std::fscanf(statm, "%ld %ld", &pages, &resident);
+    std::fclose(statm);
+    return fields == 2 ? qint64(resident) * sysconf(_SC_PAGESIZE) : -1;
+#else
+    return -1;
+#endif
+}
+
+QString FootprintReport::generate(const QWidget* window, const QStackedWidget* views)
+{
+    QString report;
+    QTextStream out(&report);
+
+    out << "Safe Airway footprint report (format " << FormatVersion << ")\n";
+    out << "Qt " << qVersion() << ", " << QGuiApplication::platformName() << " platform\n";
+    out << QString("%1 %2\n").arg("resident KB", -24).arg(kilobytes(residentBytes()), 10);
+
+    out << "\n[view construction]\n";
+    out << QString("%1 %2 %3 %4\n").arg("view", -24).arg("before KB", 10).arg("after KB", 10).arg("added KB", 10);
+    for (const BuildSample& sample : buildSamples()) {
+        const qint64 added = sample.before < 0 || sample.after < 0 ? -1 : qMax<qint64>(0, sample.after - sample.before);
+        out << QString("%1 %2 %3 %4\n")
+               .arg(sample.viewName, -24)
+               .arg(kilobytes(sample.before), 10)
+               .arg(kilobytes(sample.after), 10)
+               .arg(kilobytes(added), 10);
+    }
+
+    // The window itself, then each view in stack order
+    QList<const QObject*> pages;
+    if (views) {
+        for (int i = 0; i < views->count(); ++i) {
+            pages.append(views->widget(i));
+        }
+    }
+
+    TreeFootprint total;
+    measureTree(window, QList<const QObject*>(), total);
+    writeSection(out, "total", total);
+
+    TreeFootprint shell;
+    measureTree(window, pages, shell);
+    writeSection(out, QString::fromLatin1(window->metaObject()->className()), shell);
+
+    for (const QObject* page : pages) {
+        TreeFootprint footprint;
+        measureTree(page, QList<const QObject*>(), footprint);
+        writeSection(out, QString::fromLatin1(page->metaObject()->className()), footprint);
+    }
+
+    return report;
+}
+
+bool FootprintReport::write(const QString& report, const QString& filePath, QString* errorMessage)
+{
+    if (filePath == "-") {
+        QTextStream(stdout) << report;
+        return true;
+    }
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        if (errorMessage) {
+            *errorMessage = QString("Cannot write %1: %2").arg(filePath, file.errorString());
+        }
+        return false;
+    }
+    file.write(report.toUtf8());
+    return true;
+}
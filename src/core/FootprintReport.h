@@ -0,0 +1,43 @@
+#ifndef FOOTPRINTREPORT_H
+#define FOOTPRINTREPORT_H
+
+#include <QString>
+
+class QWidget;
+class QStackedWidget;
+
+// What each view of the main window holds: objects and widgets by class,
+// style sheets, label pixmaps and window backing stores, plus the process
+// resident set sampled around each view's construction. The report is plain
+// text with sorted rows and KB units, so reports from two builds can be
+// diffed. Run with --footprint-report or from Debug > Footprint Report.
+class FootprintReport
+{
+public:
+    static const int FormatVersion = 1;
+
+    // Brackets the construction of one view to record the memory it added.
+    // GUI thread only.
+    class BuildScope
+    {
+    public:
+        explicit BuildScope(const char* viewName);
+        ~BuildScope();
+
+    private:
+        const char* viewName_;
+        qint64 residentBefore_;
+    };
+
+    // Resident set of this process in bytes, -1 where it cannot be read
+    static qint64 residentBytes();
+
+    // Each page of views is reported on its own, and the rest of the
+    // window's tree under the window's class name
+    static QString generate(const QWidget* window, const QStackedWidget* views);
+
+    // "-" writes to standard output
+    static bool write(const QString& report, const QString& filePath, QString* errorMessage = nullptr);
+};
+
+#endif // FOOTPRINTREPORT_H
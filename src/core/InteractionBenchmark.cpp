@@ -0,0 +1,499 @@
+#include "InteractionBenchmark.h"
+#include "AllocationCounter.h"
+#include "widgets/BaseFormWidget.h"
+#include "widgets/EmergencyPanelOverlay.h"
+#include "widgets/EmergencyOverlayService.h"
+#include <QMainWindow>
+#include <QStackedWidget>
+#include <QLineEdit>
+#include <QTextEdit>
+#include <QKeyEvent>
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QWindow>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const int BASELINE_FORMAT_VERSION = 1;
+
+// Differences below this are timer noise, not regressions
+const double NOISE_FLOOR_MS = 0.5;
+
+double percentile(const QList<double>& sorted, double fraction)
+{
+    if (sorted.isEmpty()) return 0.0;
+    int index = int(std::ceil(fraction * sorted.size())) - 1;
+    return sorted.at(qBound(0, index, int(sorted.size()) - 1));
+}
+
+double median(const QList<double>& sorted)
+{
+    if (sorted.isEmpty()) return 0.0;
+    const int middle = sorted.size() / 2;
+    return sorted.size() % 2 ? sorted.at(middle) : (sorted.at(middle - 1) + sorted.at(middle)) / 2.0;
+}
+
+void sendKey(QWidget* editor, int key, const QString& text)
+{
+    QKeyEvent press(QEvent::KeyPress, key, Qt::NoModifier, text);
+    QKeyEvent release(QEvent::KeyRelease, key, Qt::NoModifier, text);
+    QCoreApplication::sendEvent(editor, &press);
+    QCoreApplication::sendEvent(editor, &release);
+}
+
+} // namespace
+
+InteractionBenchmark::InteractionBenchmark(QMainWindow* window, const Options& options, QObject* parent)
+    : QObject(parent)
+    , window_(window)
+    , options_(options)
+    , roundTripAllocations_(-1)
+    , paintTarget_(nullptr)
+    , painted_(false)
+{
+    options_.iterations = qMax(1, options_.iterations);
+}
+
+Case InteractionBenchmark::makePopulatedCase(CaseType caseType)
+{
+    Case populated = Case::createNew(caseType);
+
+    PatientInfo patient;
+    patient.firstName = "Benchmark";
+    patient.lastName = "Patient";
+    patient.mrn = "00000000";
+    patient.dateOfBirth = "01/01/2020";
+    populated.setPatient(patient);
+
+    SpecificationTableRow spec;
+    spec.setMakeModel("Bivona");
+    spec.setSize("3.5");
+    spec.setType("Neonatal");
+    spec.setCuff("Uncuffed");
+    spec.innerDiameter = 3.5;
+    spec.outerDiameter = 5.0;
+    spec.length = 34.0;
+    spec.reorderNumber = 123456;
+    populated.setSpecTable({spec});
+
+    SuctionInfo suction;
+    suction.size = 8;
+    suction.depth = "6.5";
+    populated.setSuction(suction);
+
+    DecisionBox decision;
+    decision.maskVentilate = true;
+    decision.intubateAbove = true;
+    decision.intubateStoma = true;
+    populated.setDecisionBox(decision);
+
+    populated.setEmergencyScenario("can't suction");
+    populated.setSpecialComments(QString("Benchmark comments. ").repeated(40));
+    populated.setTrachIndication("Subglottic stenosis");
+    populated.setSurgeon("Dr. Benchmark");
+    populated.setDateOfSurgery("01/01/2024");
+    populated.setFirstTrachChange("01/08/2024");
+    populated.setAirwayDiagnosis("Laryngomalacia with subglottic stenosis");
+    populated.setProcedure("Anterior cartilage graft");
+    populated.setExtubationDate("01/15/2024");
+    return populated;
+}
+
+int InteractionBenchmark::run()
+{
+    if (!waitForExposed()) {
+        QTextStream(stderr) << "Benchmark: the main window was never exposed\n";
+        return 2;
+    }
+
+    QStackedWidget* stack = window_->findChild<QStackedWidget*>();
+    BaseFormWidget* form = window_->findChild<BaseFormWidget*>();
+    if (!stack || !form) {
+        QTextStream(stderr) << "Benchmark: main window views not found\n";
+        return 2;
+    }
+
+    // Typing happens in a loaded form
+    stack->setCurrentWidget(form);
+    form->setCase(makePopulatedCase(form->getCaseType()));
+    settle();
+
+    benchmarkTyping("typing/patient-first-name", form->findChild<QLineEdit*>("firstNameEdit"));
+    benchmarkTyping("typing/tube-type", form->findChild<QLineEdit*>("tubeTypeEdit"));
+    benchmarkTyping("typing/special-comments", form->findChild<QTextEdit*>("specialCommentsEdit"));
+    benchmarkViewSwitching();
+    benchmarkSetCase();
+    benchmarkEmergencyOverlay();
+    benchmarkSaveSnapshot();
+    countRoundTripAllocations();
+
+    printReport();
+
+    if (options_.baselinePath.isEmpty()) {
+        return 0;
+    }
+    if (options_.updateBaseline || !QFileInfo::exists(options_.baselinePath)) {
+        return saveBaseline(options_.baselinePath) ? 0 : 2;
+    }
+    return compareWithBaseline(options_.baselinePath);
+}
+
+bool InteractionBenchmark::waitForExposed()
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (timer.elapsed() < 5000) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+        if (window_->windowHandle() && window_->windowHandle()->isExposed()) {
+            settle();
+            return true;
+        }
+    }
+    return false;
+}
+
+void InteractionBenchmark::settle()
+{
+    // Flush pending layout and paint work so it is not charged to the next sample
+    for (int i = 0; i < 3; ++i) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents);
+    }
+}
+
+bool InteractionBenchmark::eventFilter(QObject* watched, QEvent* event)
+{
+    if (event->type() == QEvent::Paint && paintTarget_ && watched->isWidgetType()) {
+        QWidget* widget = static_cast<QWidget*>(watched);
+        if (widget == paintTarget_ || paintTarget_->isAncestorOf(widget)) {
+            painted_ = true;
+        }
+    }
+    return false;
+}
+
+double InteractionBenchmark::measureUntilPainted(QWidget* target, const std::function<void()>& action)
+{
+    paintTarget_ = target;
+    painted_ = false;
+    QCoreApplication::instance()->installEventFilter(this);
+
+    QElapsedTimer timer;
+    timer.start();
+    action();
+
+    // The paint itself is dispatched from here, so it is inside the measurement
+    while (!painted_ && timer.elapsed() < PAINT_TIMEOUT_MS) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents);
+    }
+    const double elapsedMs = timer.nsecsElapsed() / 1.0e6;
+
+    QCoreApplication::instance()->removeEventFilter(this);
+    paintTarget_ = nullptr;
+
+    if (!painted_) {
+        QTextStream(stderr) << "Benchmark: no paint within " << PAINT_TIMEOUT_MS << " ms\n";
+    }
+    return elapsedMs;
+}
+
+void InteractionBenchmark::measure(const QString& name, QWidget* target, const std::function<void(int)>& action,
+                                   const std::function<void()>& reset)
+{
+    if (!target) {
+        QTextStream(stderr) << "Benchmark: skipping " << name << ", widget not found\n";
+        return;
+    }
+
+    QList<double> samples;
+    for (int i = 0; i < WARMUP_ITERATIONS + options_.iterations; ++i) {
+        const double elapsedMs = measureUntilPainted(target, [&action, i]() { action(i); });
+        if (i >= WARMUP_ITERATIONS) {
+            samples.append(elapsedMs);
+        }
+        if (reset) {
+            reset();
+        }
+        settle();
+    }
+
+    addResult(name, samples);
+}
+
+void InteractionBenchmark::addResult(const QString& name, QList<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+
+    Result result;
+    result.name = name;
+    result.samples = samples.size();
+    result.medianMs = median(samples);
+    result.p99Ms = percentile(samples, 0.99);
+    results_.append(result);
+}
+
+void InteractionBenchmark::benchmarkTyping(const QString& name, QWidget* editor)
+{
+    QLineEdit* lineEdit = qobject_cast<QLineEdit*>(editor);
+    QTextEdit* textEdit = qobject_cast<QTextEdit*>(editor);
+    const QString original = lineEdit ? lineEdit->text() : (textEdit ? textEdit->toPlainText() : QString());
+
+    // Alternate typing and deleting so the field length stays steady
+    measure(name, editor, [editor](int i) {
+        if (i % 2 == 0) {
+            sendKey(editor, Qt::Key_A, "a");
+        } else {
+            sendKey(editor, Qt::Key_Backspace, QString());
+        }
+    });
+
+    if (lineEdit) {
+        lineEdit->setText(original);
+    } else if (textEdit) {
+        textEdit->setPlainText(original);
+    }
+    settle();
+}
+
+void InteractionBenchmark::benchmarkViewSwitching()
+{
+    QStackedWidget* stack = window_->findChild<QStackedWidget*>();
+    if (!stack) return;
+
+    // Alternate between the case selection and the form
+    const int viewCount = qMin(2, stack->count());
+    const int startIndex = stack->currentIndex();
+    measure("switch/stacked-views", stack, [stack, viewCount](int i) {
+        stack->setCurrentIndex((i + 1) % viewCount);
+    });
+    stack->setCurrentIndex(startIndex);
+    settle();
+}
+
+void InteractionBenchmark::benchmarkSetCase()
+{
+    QStackedWidget* stack = window_->findChild<QStackedWidget*>();
+    BaseFormWidget* form = window_->findChild<BaseFormWidget*>();
+    if (!stack || !form) return;
+
+    stack->setCurrentWidget(form);
+    settle();
+
+    // Two different cases so every load changes every field
+    Case first = makePopulatedCase(form->getCaseType());
+    Case second = makePopulatedCase(form->getCaseType());
+    PatientInfo patient = second.getPatient();
+    patient.firstName = "Other";
+    second.setPatient(patient);
+    second.setSpecialComments(QString("Other comments. ").repeated(40));
+
+    measure("load/set-case", form, [form, &first, &second](int i) {
+        form->setCase(i % 2 == 0 ? second : first);
+    });
+
+    // Loading a case of another type also swaps the form's case type section
+    const QList<Case> byType = {
+        makePopulatedCase(CaseType::Tracheostomy),
+        makePopulatedCase(CaseType::NewTracheostomy),
+        makePopulatedCase(CaseType::DifficultAirway),
+        makePopulatedCase(CaseType::LTR)
+    };
+    measure("load/switch-case-type", form, [form, &byType](int i) {
+        form->setCase(byType.at((i + 1) % byType.size()));
+    });
+    form->setCase(first);
+    settle();
+}
+
+void InteractionBenchmark::benchmarkEmergencyOverlay()
+{
+    EmergencyPanelOverlay* overlay = EmergencyOverlayService::instance().overlay();
+
+    // The overlay also times itself from showOverlay() to its own first paint
+    QList<double> openToPaint;
+    int iteration = 0;
+    measure("overlay/open", overlay,
+            [overlay](int) { overlay->showOverlay(); },
+            [overlay, &openToPaint, &iteration]() {
+                overlay->hideOverlay();
+                if (iteration++ >= WARMUP_ITERATIONS) {
+                    openToPaint.append(overlay->lastOpenMs());
+                }
+            });
+    if (!openToPaint.isEmpty()) {
+        addResult("overlay/open-to-paint", openToPaint);
+    }
+}
+
+void InteractionBenchmark::benchmarkSaveSnapshot()
+{
+    BaseFormWidget* form = window_->findChild<BaseFormWidget*>();
+    QLineEdit* editor = form ? form->findChild<QLineEdit*>("firstNameEdit") : nullptr;
+    if (!editor) {
+        QTextStream(stderr) << "Benchmark: skipping save/snapshot, widget not found\n";
+        return;
+    }
+
+    // The form side of a save after one edited field: snapshot, record the
+    // save, then drain whatever that queued. Serializing and writing happen
+    // on the case writer thread, so nothing here depends on the drive.
+    const QString original = editor->text();
+    QList<double> samples;
+    for (int i = 0; i < WARMUP_ITERATIONS + options_.iterations; ++i) {
+        editor->setText(i % 2 == 0 ? "Edited" : original);
+        settle();
+
+        QElapsedTimer timer;
+        timer.start();
+        const Case snapshot = form->getCase();
+        form->markSaved(snapshot.getFilePath(), snapshot.getUpdatedAt());
+        QCoreApplication::processEvents(QEventLoop::AllEvents);
+        const double elapsedMs = timer.nsecsElapsed() / 1.0e6;
+
+        if (i >= WARMUP_ITERATIONS) {
+            samples.append(elapsedMs);
+        }
+    }
+
+    editor->setText(original);
+    settle();
+    addResult("save/snapshot", samples);
+}
+
+void InteractionBenchmark::countRoundTripAllocations()
+{
+    BaseFormWidget* form = window_->findChild<BaseFormWidget*>();
+    if (!form || !AllocationCounter::isEnabled()) return;
+
+    // Snapshot, serialize, parse and hand back, as a save followed by a load
+    // does, minus the disk and the widgets
+    auto roundTrip = [form]() {
+        const Case snapshot = form->getCase();
+        const QByteArray json = QJsonDocument(snapshot.toJson()).toJson();
+        Case loaded = Case::fromJson(QJsonDocument::fromJson(json).object());
+        loaded.setFilePath(snapshot.getFilePath());
+        const Case copy = loaded;
+        return copy.getSpecTable().size();
+    };
+
+    roundTrip();
+    const quint64 before = AllocationCounter::count();
+    for (int i = 0; i < options_.iterations; ++i) {
+        roundTrip();
+    }
+    roundTripAllocations_ = qint64((AllocationCounter::count() - before) / quint64(options_.iterations));
+}
+
+void InteractionBenchmark::printReport() const
+{
+    QTextStream out(stdout);
+    out << "Interaction benchmark (" << QGuiApplication::platformName() << ", "
+        << options_.iterations << " iterations)\n";
+    out << QString("%1 %2 %3\n").arg("benchmark", -32).arg("median ms", 10).arg("p99 ms", 10);
+    for (const Result& result : results_) {
+        out << QString("%1 %2 %3\n")
+               .arg(result.name, -32)
+               .arg(result.medianMs, 10, 'f', 2)
+               .arg(result.p99Ms, 10, 'f', 2);
+    }
+    if (roundTripAllocations_ >= 0) {
+        out << "Allocations per save/load round trip: " << roundTripAllocations_ << "\n";
+    }
+}
+
+bool InteractionBenchmark::saveBaseline(const QString& filePath) const
+{
+    QJsonObject benchmarks;
+    for (const Result& result : results_) {
+        QJsonObject entry;
+        entry["medianMs"] = result.medianMs;
+        entry["p99Ms"] = result.p99Ms;
+        entry["samples"] = result.samples;
+        benchmarks[result.name] = entry;
+    }
+
+    QJsonObject root;
+    root["formatVersion"] = BASELINE_FORMAT_VERSION;
+    root["platform"] = QGuiApplication::platformName();
+    root["iterations"] = options_.iterations;
+    root["benchmarks"] = benchmarks;
+    if (roundTripAllocations_ >= 0) {
+        root["roundTripAllocations"] = roundTripAllocations_;
+    }
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        QTextStream(stderr) << "Benchmark: cannot write baseline: " << file.errorString() << "\n";
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+
+    QTextStream(stdout) << "Baseline written to " << filePath << "\n";
+    return true;
+}
+
+int InteractionBenchmark::compareWithBaseline(const QString& filePath) const
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        QTextStream(stderr) << "Benchmark: cannot read baseline: " << file.errorString() << "\n";
+        return 2;
+    }
+
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    if (root["formatVersion"].toInt() != BASELINE_FORMAT_VERSION) {
+        QTextStream(stderr) << "Benchmark: unsupported baseline format in " << filePath << "\n";
+        return 2;
+    }
+
+    QTextStream out(stdout);
+    if (root["platform"].toString() != QGuiApplication::platformName()) {
+        out << "Note: baseline was recorded on the " << root["platform"].toString() << " platform\n";
+    }
+
+    const QJsonObject benchmarks = root["benchmarks"].toObject();
+    int regressions = 0;
+
+    out << QString("%1 %2 %3 %4\n").arg("benchmark", -32).arg("baseline", 10).arg("median", 10).arg("change", 10);
+    for (const Result& result : results_) {
+        if (!benchmarks.contains(result.name)) {
+            out << QString("%1 %2\n").arg(result.name, -32).arg("new", 10);
+            continue;
+        }
+
+        const double baseline = benchmarks[result.name].toObject()["medianMs"].toDouble();
+        const double change = baseline > 0.0 ? (result.medianMs - baseline) / baseline : 0.0;
+        const bool regressed = result.medianMs > baseline * (1.0 + options_.tolerance) + NOISE_FLOOR_MS;
+        if (regressed) {
+            ++regressions;
+        }
+
+        out << QString("%1 %2 %3 %4%5\n")
+               .arg(result.name, -32)
+               .arg(baseline, 10, 'f', 2)
+               .arg(result.medianMs, 10, 'f', 2)
+               .arg(QString("%1%").arg(change * 100.0, 0, 'f', 1), 10)
+               .arg(regressed ? "  REGRESSED" : "");
+    }
+
+    // Allocation counts are reported side by side but never fail the run
+    if (roundTripAllocations_ >= 0 && root.contains("roundTripAllocations")) {
+        out << "Allocations per save/load round trip: "
+            << root["roundTripAllocations"].toInteger() << " baseline, "
+            << roundTripAllocations_ << " now\n";
+    }
+
+    if (regressions > 0) {
+        out << regressions << " benchmark(s) slower than the baseline by more than "
+            << int(options_.tolerance * 100) << "%\n";
+        return 1;
+    }
+    return 0;
+}
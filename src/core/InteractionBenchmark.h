@@ -0,0 +1,80 @@
+#ifndef INTERACTIONBENCHMARK_H
+#define INTERACTIONBENCHMARK_H
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <functional>
+#include "models/Case.h"
+
+class QMainWindow;
+class QWidget;
+
+// Measures the interactions clinicians feel, against the real main window:
+// keystroke-to-paint in the form editors, switching views, loading a full case
+// into a form and opening the emergency overlay. Each is timed from the input
+// until the affected widget has painted; saving is timed until the event loop
+// is idle again. Run with --benchmark, optionally on
+// the offscreen platform (-platform offscreen).
+class InteractionBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Options {
+        int iterations = 50;
+        QString baselinePath;          // compared against, or written if missing
+        bool updateBaseline = false;   // overwrite the baseline with this run
+        double tolerance = 0.2;        // allowed median slowdown before failing
+    };
+
+    InteractionBenchmark(QMainWindow* window, const Options& options, QObject* parent = nullptr);
+
+    // Returns the process exit code: non-zero if a baseline comparison regressed
+    int run();
+
+    // A case with every field filled in, as a worst case for loading
+    static Case makePopulatedCase(CaseType caseType);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    struct Result {
+        QString name;
+        int samples = 0;
+        double medianMs = 0.0;
+        double p99Ms = 0.0;
+    };
+
+    static const int WARMUP_ITERATIONS = 3;
+    static const int PAINT_TIMEOUT_MS = 2000;
+
+    QMainWindow* window_;
+    Options options_;
+    QList<Result> results_;
+    qint64 roundTripAllocations_;  // -1 unless allocation counting is built in
+
+    QWidget* paintTarget_;
+    bool painted_;
+
+    bool waitForExposed();
+    double measureUntilPainted(QWidget* target, const std::function<void()>& action);
+    void measure(const QString& name, QWidget* target, const std::function<void(int)>& action,
+                 const std::function<void()>& reset = std::function<void()>());
+    void settle();
+    void addResult(const QString& name, QList<double> samples);
+
+    void benchmarkTyping(const QString& name, QWidget* editor);
+    void benchmarkViewSwitching();
+    void benchmarkSetCase();
+    void benchmarkEmergencyOverlay();
+    void benchmarkSaveSnapshot();
+    void countRoundTripAllocations();
+
+    void printReport() const;
+    bool saveBaseline(const QString& filePath) const;
+    int compareWithBaseline(const QString& filePath) const;
+};
+
+#endif // INTERACTIONBENCHMARK_H
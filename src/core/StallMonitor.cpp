@@ -0,0 +1,451 @@
+#include "StallMonitor.h"
+#include <QCoreApplication>
+#include <QAbstractEventDispatcher>
+#include <QMetaEnum>
+#include <QEvent>
+#include <QDebug>
+#include <QMetaMethod>
+
+// Queued calls name their signal when Qt's private headers are available
+#if __has_include(<QtCore/private/qobject_p.h>) && __has_include(<QtCore/private/qmetaobject_p.h>)
+#define SAFE_AIRWAY_METACALL_NAMES 1
+#include <QtCore/private/qobject_p.h>
+#include <QtCore/private/qmetaobject_p.h>
+#endif
+
+#if defined(Q_OS_LINUX) && defined(__GLIBC__)
+#define SAFE_AIRWAY_STACK_SAMPLING 1
+#include <execinfo.h>
+#include <pthread.h>
+#include <signal.h>
+#include <cstdlib>
+#endif
+
+namespace {
+
+// Read by Scope without touching the singleton
+std::atomic<bool> g_monitorRunning(false);
+
+#ifdef SAFE_AIRWAY_STACK_SAMPLING
+const int MAX_STACK_FRAMES = 48;
+const int SAMPLE_SIGNAL = SIGUSR2;
+
+void* g_sampleFrames[MAX_STACK_FRAMES];
+std::atomic<int> g_sampleDepth(-1);
+pthread_t g_guiThread;
+
+void sampleStackHandler(int)
+{
+    // Runs on the GUI thread, interrupted wherever it is blocked
+    g_sampleDepth.store(backtrace(g_sampleFrames, MAX_STACK_FRAMES));
+}
+
+QStringList sampleGuiThreadStack()
+{
+    g_sampleDepth.store(-1);
+    if (pthread_kill(g_guiThread, SAMPLE_SIGNAL) != 0) {
+        return QStringList();
+    }
+
+    for (int i = 0; i < 50 && g_sampleDepth.load() < 0; ++i) {
+        QThread::usleep(200);
+    }
+
+    const int depth = g_sampleDepth.load();
+    if (depth <= 0) {
+        return QStringList();
+    }
+
+    QStringList frames;
+    char** symbols = backtrace_symbols(g_sampleFrames, depth);
+    if (symbols) {
+        // Skip the handler and signal trampoline frames
+        for (int i = 2; i < depth; ++i) {
+            frames << QString::fromLocal8Bit(symbols[i]);
+        }
+        free(symbols);
+    }
+    return frames;
+}
+#endif
+
+QString eventTypeName(int type)
+{
+    const char* key = QMetaEnum::fromType<QEvent::Type>().valueToKey(type);
+    return key ? QString::fromLatin1(key) : QString::number(type);
+}
+
+// "Sender::signal()" for a queued call, empty when it cannot be told
+QString metaCallSignal(QEvent* event)
+{
+#ifdef SAFE_AIRWAY_METACALL_NAMES
+    if (event->type() != QEvent::MetaCall) return QString();
+
+    const QAbstractMetaCallEvent* call = static_cast<QAbstractMetaCallEvent*>(event);
+    const QObject* sender = call->sender();
+    if (!sender || call->signalId() < 0) return QString();
+
+    const QMetaMethod signal = QMetaObjectPrivate::signal(sender->metaObject(), call->signalId());
+    if (!signal.isValid()) return QString();
+    return QString("%1::%2").arg(QString::fromLatin1(sender->metaObject()->className()),
+                                 QString::fromLatin1(signal.methodSignature()));
+#else
+    Q_UNUSED(event)
+    return QString();
+#endif
+}
+
+} // namespace
+
+StallMonitor* StallMonitor::instance_ = nullptr;
+
+StallMonitor::StallMonitor()
+    : QObject(nullptr)
+    , running_(false)
+    , thresholdMs_(50)
+    , stackSampling_(false)
+    , deliveryDepth_(0)
+    , lastIncidentEndNs_(0)
+    , nextIncident_(0)
+    , watchdogThread_(nullptr)
+    , stopWatchdog_(false)
+    , pingSentNs_(0)
+{
+}
+
+StallMonitor::~StallMonitor()
+{
+    stop();
+}
+
+StallMonitor& StallMonitor::instance()
+{
+    if (!instance_) {
+        instance_ = new StallMonitor();
+    }
+    return *instance_;
+}
+
+void StallMonitor::start()
+{
+    if (running_ || !QCoreApplication::instance()) return;
+
+    clock_.start();
+    current_ = Dispatch();
+    nested_.clear();
+    lastIncidentEndNs_ = 0;
+    running_ = true;
+    g_monitorRunning = true;
+
+    if (!dynamic_cast<MonitoredApplication*>(QCoreApplication::instance())) {
+        qWarning("StallMonitor: the application is not a MonitoredApplication; only freezes are caught");
+    }
+
+    QAbstractEventDispatcher* dispatcher = QAbstractEventDispatcher::instance(thread());
+    if (dispatcher) {
+        connect(dispatcher, &QAbstractEventDispatcher::awake, this, &StallMonitor::onAwake, Qt::DirectConnection);
+        connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock, this, &StallMonitor::onAboutToBlock, Qt::DirectConnection);
+    }
+
+#ifdef SAFE_AIRWAY_STACK_SAMPLING
+    g_guiThread = pthread_self();
+#endif
+
+    stopWatchdog_ = false;
+    pingSentNs_ = 0;
+    watchdogThread_ = QThread::create([this]() { runWatchdog(); });
+    watchdogThread_->setObjectName("StallMonitorWatchdog");
+    watchdogThread_->start(QThread::HighPriority);
+}
+
+void StallMonitor::stop()
+{
+    if (!running_) return;
+
+    stopWatchdog_ = true;
+    watchdogThread_->wait();
+    delete watchdogThread_;
+    watchdogThread_ = nullptr;
+
+    QAbstractEventDispatcher* dispatcher = QAbstractEventDispatcher::instance(thread());
+    if (dispatcher) {
+        disconnect(dispatcher, nullptr, this, nullptr);
+    }
+
+    setStackSamplingEnabled(false);
+    running_ = false;
+    g_monitorRunning = false;
+    current_ = Dispatch();
+    nested_.clear();
+}
+
+void StallMonitor::setThresholdMs(int thresholdMs)
+{
+    thresholdMs_ = qMax(1, thresholdMs);
+}
+
+bool StallMonitor::isStackSamplingSupported()
+{
+#ifdef SAFE_AIRWAY_STACK_SAMPLING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void StallMonitor::setStackSamplingEnabled(bool enabled)
+{
+#ifdef SAFE_AIRWAY_STACK_SAMPLING
+    if (enabled == stackSampling_) return;
+
+    if (enabled) {
+        // backtrace() loads its unwinder on first use; do that outside the handler
+        void* frames[4];
+        backtrace(frames, 4);
+
+        struct sigaction action = {};
+        action.sa_handler = sampleStackHandler;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SAMPLE_SIGNAL, &action, nullptr);
+    } else {
+        signal(SAMPLE_SIGNAL, SIG_IGN);
+    }
+    stackSampling_ = enabled;
+#else
+    Q_UNUSED(enabled)
+#endif
+}
+
+QList<StallIncident> StallMonitor::getIncidents() const
+{
+    QMutexLocker locker(&mutex_);
+
+    QList<StallIncident> incidents;
+    incidents.reserve(incidents_.size());
+    const int start = incidents_.size() < MAX_INCIDENTS ? 0 : nextIncident_;
+    for (int i = 0; i < incidents_.size(); ++i) {
+        incidents.append(incidents_.at((start + i) % incidents_.size()));
+    }
+    return incidents;
+}
+
+void StallMonitor::clearIncidents()
+{
+    QMutexLocker locker(&mutex_);
+    incidents_.clear();
+    nextIncident_ = 0;
+}
+
+void StallMonitor::beginDelivery(QObject* receiver, QEvent* event)
+{
+    const qint64 now = clock_.nsecsElapsed();
+    ++deliveryDepth_;
+
+    // Nested deliveries belong to the open dispatch. A nested event loop
+    // closes that dispatch when it blocks, and its own events start new ones.
+    if (current_.active && current_.depth > 0) {
+        NestedDelivery delivery;
+        delivery.depth = deliveryDepth_;
+        delivery.className = receiver->metaObject()->className();
+        delivery.eventType = event->type();
+        delivery.startNs = now;
+        nested_.append(delivery);
+        return;
+    }
+
+    closeDispatch(now);
+    current_.active = true;
+    current_.receiver = receiver;
+    current_.className = receiver->metaObject()->className();
+    current_.eventType = event->type();
+    current_.signal = metaCallSignal(event);
+    current_.startNs = now;
+    current_.depth = deliveryDepth_;
+}
+
+void StallMonitor::endDelivery()
+{
+    const qint64 now = clock_.nsecsElapsed();
+    const int depth = deliveryDepth_--;
+
+    if (current_.active && current_.depth == depth) {
+        closeDispatch(now);
+        openLoopDispatch(now);
+        return;
+    }
+
+    if (!nested_.isEmpty() && nested_.last().depth == depth) {
+        const NestedDelivery delivery = nested_.takeLast();
+        const qint64 elapsed = now - delivery.startNs;
+        if (elapsed >= thresholdNs()) {
+            current_.slowScopes.append(QString("%1 %2 (%3 ms)")
+                                       .arg(QString::fromLatin1(delivery.className), eventTypeName(delivery.eventType))
+                                       .arg(elapsed / 1000000));
+        }
+    }
+}
+
+void StallMonitor::onAwake()
+{
+    const qint64 now = clock_.nsecsElapsed();
+    closeDispatch(now);
+    openLoopDispatch(now);
+}
+
+void StallMonitor::openLoopDispatch(qint64 nowNs)
+{
+    // Work outside event delivery (native messages, socket notifiers) is
+    // charged to the loop itself
+    current_ = Dispatch();
+    current_.active = true;
+    current_.className = "QEventLoop";
+    current_.eventType = QEvent::None;
+    current_.startNs = nowNs;
+}
+
+void StallMonitor::onAboutToBlock()
+{
+    closeDispatch(clock_.nsecsElapsed());
+}
+
+void StallMonitor::closeDispatch(qint64 nowNs)
+{
+    if (!current_.active) return;
+
+    const qint64 elapsed = nowNs - current_.startNs;
+    if (elapsed >= thresholdNs()) {
+        StallIncident incident;
+        incident.when = QDateTime::currentDateTime().addMSecs(-elapsed / 1000000);
+        incident.durationMs = elapsed / 1000000;
+        incident.receiver = QString::fromLatin1(current_.className);
+        if (current_.receiver && !current_.receiver->objectName().isEmpty()) {
+            incident.receiver += " \"" + current_.receiver->objectName() + "\"";
+        }
+        incident.eventType = eventTypeName(current_.eventType);
+        if (!current_.signal.isEmpty()) {
+            incident.eventType += " from " + current_.signal;
+        }
+        incident.scopes = current_.slowScopes;
+        recordIncident(incident);
+        lastIncidentEndNs_ = nowNs;
+    }
+
+    current_ = Dispatch();
+    nested_.clear();
+}
+
+void StallMonitor::recordIncident(StallIncident incident)
+{
+    {
+        QMutexLocker locker(&mutex_);
+
+        // A stack taken by the watchdog belongs to the stall that just ended
+        if (incident.stack.isEmpty()) {
+            incident.stack = pendingStack_;
+        }
+        pendingStack_.clear();
+
+        if (incidents_.size() < MAX_INCIDENTS) {
+            incidents_.append(incident);
+            nextIncident_ = incidents_.size() % MAX_INCIDENTS;
+        } else {
+            incidents_[nextIncident_] = incident;
+            nextIncident_ = (nextIncident_ + 1) % MAX_INCIDENTS;
+        }
+    }
+
+    qWarning().noquote() << QString("Event loop stall: %1 ms in %2 (%3)%4")
+                            .arg(incident.durationMs)
+                            .arg(incident.receiver, incident.eventType,
+                                 incident.scopes.isEmpty() ? QString() : " during " + incident.scopes.join(" < "));
+
+    emit incidentRecorded(incident);
+}
+
+void StallMonitor::runWatchdog()
+{
+    const int interval = qMax(5, thresholdMs_.load() / 2);
+    qint64 sampledPing = 0;
+
+    while (!stopWatchdog_) {
+        const qint64 now = clock_.nsecsElapsed();
+        const qint64 sent = pingSentNs_.load();
+
+        if (sent == 0) {
+            pingSentNs_ = now;
+            QMetaObject::invokeMethod(this, &StallMonitor::onPing, Qt::QueuedConnection);
+        } else if (now - sent >= thresholdNs() && sampledPing != sent) {
+            // The loop has not answered within the threshold: it is blocked right now
+            sampledPing = sent;
+#ifdef SAFE_AIRWAY_STACK_SAMPLING
+            if (stackSampling_) {
+                QStringList stack = sampleGuiThreadStack();
+                QMutexLocker locker(&mutex_);
+                pendingStack_ = stack;
+            }
+#endif
+        }
+
+        QThread::msleep(interval);
+    }
+}
+
+void StallMonitor::onPing()
+{
+    const qint64 sent = pingSentNs_.load();
+    const qint64 now = clock_.nsecsElapsed();
+    pingSentNs_ = 0;
+
+    // Late pings already covered by a dispatch incident are not reported twice
+    if (sent == 0 || now - sent < thresholdNs() || lastIncidentEndNs_ >= sent) {
+        return;
+    }
+
+    StallIncident incident;
+    incident.when = QDateTime::currentDateTime().addMSecs(-(now - sent) / 1000000);
+    incident.durationMs = (now - sent) / 1000000;
+    incident.receiver = "(outside event delivery)";
+    incident.eventType = "Watchdog";
+    recordIncident(incident);
+    lastIncidentEndNs_ = now;
+}
+
+StallMonitor::Scope::Scope(const char* label)
+    : label_(label)
+    , startNs_(-1)
+{
+    if (g_monitorRunning.load(std::memory_order_relaxed)
+        && QThread::currentThread() == StallMonitor::instance().thread()) {
+        startNs_ = StallMonitor::instance().clock_.nsecsElapsed();
+    }
+}
+
+StallMonitor::Scope::~Scope()
+{
+    if (startNs_ < 0 || !g_monitorRunning.load(std::memory_order_relaxed)) return;
+
+    StallMonitor& monitor = StallMonitor::instance();
+    const qint64 elapsed = monitor.clock_.nsecsElapsed() - startNs_;
+    if (elapsed >= monitor.thresholdNs() && monitor.current_.active) {
+        monitor.current_.slowScopes.append(QString("%1 (%2 ms)").arg(label_).arg(elapsed / 1000000));
+    }
+}
+
+MonitoredApplication::MonitoredApplication(int& argc, char** argv)
+    : QApplication(argc, argv)
+{
+}
+
+bool MonitoredApplication::notify(QObject* receiver, QEvent* event)
+{
+    if (!g_monitorRunning.load(std::memory_order_relaxed) || QThread::currentThread() != thread()) {
+        return QApplication::notify(receiver, event);
+    }
+
+    StallMonitor& monitor = StallMonitor::instance();
+    monitor.beginDelivery(receiver, event);
+    const bool result = QApplication::notify(receiver, event);
+    monitor.endDelivery();
+    return result;
+}
@@ -0,0 +1,152 @@
+#ifndef STALLMONITOR_H
+#define STALLMONITOR_H
+
+#include <QObject>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QDateTime>
+#include <QStringList>
+#include <QPointer>
+#include <QMutex>
+#include <QVector>
+#include <QThread>
+#include <atomic>
+
+// One event dispatch (or watchdog-detected freeze) that blocked the GUI thread
+struct StallIncident {
+    QDateTime when;
+    qint64 durationMs = 0;
+    QString receiver;       // class name and objectName of the receiving object
+    QString eventType;      // QEvent::Type name; queued calls also name their signal
+    QStringList scopes;     // slow Scope labels and nested deliveries inside the dispatch, innermost first
+    QStringList stack;      // GUI thread stack sampled while it was blocked, if enabled
+};
+
+// Finds event loop stalls on the GUI thread and attributes them.
+//
+// MonitoredApplication::notify() reports where each event delivery starts and
+// ends. Only the outermost delivery is a dispatch, so its time includes every
+// event it sent synchronously; slow nested deliveries are named inside it.
+// The dispatcher's awake/aboutToBlock hooks charge the time between deliveries
+// to the loop itself. A watchdog thread also pings the loop, which catches
+// freezes outside Qt's event delivery and can sample the GUI thread's stack
+// while it is blocked.
+//
+// Off by default; the hooks and the watchdog only exist while it is running.
+class StallMonitor : public QObject
+{
+    Q_OBJECT
+
+public:
+    static StallMonitor& instance();
+
+    static constexpr int MAX_INCIDENTS = 64;
+
+    // Call from the GUI thread
+    void start();
+    void stop();
+    bool isRunning() const { return running_; }
+
+    void setThresholdMs(int thresholdMs);
+    int getThresholdMs() const { return thresholdMs_; }
+
+    // Stack samples use a signal handler and are only available on Linux
+    static bool isStackSamplingSupported();
+    void setStackSamplingEnabled(bool enabled);
+    bool isStackSamplingEnabled() const { return stackSampling_; }
+
+    // Most recent incidents, oldest first
+    QList<StallIncident> getIncidents() const;
+    void clearIncidents();
+
+    // Labels a block of GUI-thread work; a block slower than the threshold is
+    // named in the incident of the dispatch that ran it. Near free when stopped.
+    class Scope
+    {
+    public:
+        explicit Scope(const char* label);
+        ~Scope();
+
+    private:
+        const char* label_;
+        qint64 startNs_;
+    };
+
+signals:
+    void incidentRecorded(const StallIncident& incident);
+
+private slots:
+    void onAwake();
+    void onAboutToBlock();
+
+private:
+    StallMonitor();
+    ~StallMonitor();
+
+    static StallMonitor* instance_;
+
+    friend class MonitoredApplication;
+
+    struct Dispatch {
+        bool active = false;
+        QPointer<QObject> receiver;
+        const char* className = nullptr;
+        int eventType = 0;
+        QString signal;         // the signal behind a queued call, if known
+        qint64 startNs = 0;
+        int depth = 0;          // delivery depth it started at; 0 for the loop itself
+        QStringList slowScopes;
+    };
+
+    // A delivery nested inside the current dispatch
+    struct NestedDelivery {
+        int depth = 0;
+        const char* className = nullptr;
+        int eventType = 0;
+        qint64 startNs = 0;
+    };
+
+    bool running_;
+    // Also read by the watchdog thread
+    std::atomic<int> thresholdMs_;
+    std::atomic<bool> stackSampling_;
+
+    QElapsedTimer clock_;
+    Dispatch current_;
+    QVector<NestedDelivery> nested_;
+    int deliveryDepth_;
+    qint64 lastIncidentEndNs_;
+
+    // Ring buffer, shared with the watchdog
+    mutable QMutex mutex_;
+    QVector<StallIncident> incidents_;
+    int nextIncident_;
+    QStringList pendingStack_;
+
+    // Watchdog state
+    QThread* watchdogThread_;
+    std::atomic<bool> stopWatchdog_;
+    std::atomic<qint64> pingSentNs_;
+
+    void beginDelivery(QObject* receiver, QEvent* event);
+    void endDelivery();
+    void openLoopDispatch(qint64 nowNs);
+    void closeDispatch(qint64 nowNs);
+    void recordIncident(StallIncident incident);
+    void runWatchdog();
+    void onPing();
+
+    qint64 thresholdNs() const { return qint64(thresholdMs_.load()) * 1000000; }
+};
+
+// The application object; it lets StallMonitor time every event delivery,
+// including nested ones. Costs one atomic load per event while stopped.
+class MonitoredApplication : public QApplication
+{
+public:
+    MonitoredApplication(int& argc, char** argv);
+
+    bool notify(QObject* receiver, QEvent* event) override;
+};
+
+#endif // STALLMONITOR_H
@@ -5,10 +5,10 @@
 QJsonObject SpecificationTableRow::toJson() const
 {
     QJsonObject json;
-    json["makeModel"] = makeModel;
-    json["size"] = size;
-    json["type"] = type;
-    json["cuff"] = cuff;
+    json["makeModel"] = makeModel();
+    json["size"] = size();
+    json["type"] = type();
+    json["cuff"] = cuff();
     json["innerDiameter"] = innerDiameter;
     json["outerDiameter"] = outerDiameter;
     json["length"] = length;
@@ -19,10 +19,10 @@ QJsonObject SpecificationTableRow::toJson() const
 SpecificationTableRow SpecificationTableRow::fromJson(const QJsonObject& json)
 {
     SpecificationTableRow row;
-    row.makeModel = json["makeModel"].toString();
-    row.size = json["size"].toString();
-    row.type = json["type"].toString();
-    row.cuff = json["cuff"].toString();
+    row.setMakeModel(json["makeModel"].toString());
+    row.setSize(json["size"].toString());
+    row.setType(json["type"].toString());
+    row.setCuff(json["cuff"].toString());
     row.innerDiameter = json["innerDiameter"].toDouble();
     row.outerDiameter = json["outerDiameter"].toDouble();
     row.length = json["length"].toDouble();
@@ -30,6 +30,25 @@ SpecificationTableRow SpecificationTableRow::fromJson(const QJsonObject& json)
     return row;
 }
 
+QString SpecificationTableRow::text(TubeVocabulary::Field field, quint32 id, const QString& custom)
+{
+    return id == TubeVocabulary::CustomId ? custom : TubeVocabulary::instance().text(field, id);
+}
+
+void SpecificationTableRow::assign(TubeVocabulary::Field field, const QString& text, quint32& id, QString& custom)
+{
+    id = TubeVocabulary::instance().id(field, text);
+    custom = id == TubeVocabulary::CustomId ? text : QString();
+}
+
+TubeManufacturer SpecificationTableRow::manufacturer() const
+{
+    if (makeModelId <= quint32(TubeManufacturer::Custom)) {
+        return TubeManufacturer(makeModelId);
+    }
+    return TubeManufacturer::Other;
+}
+
 QJsonObject PatientInfo::toJson() const
 {
     QJsonObject json;
@@ -55,6 +74,8 @@ QJsonObject SuctionInfo::toJson() const
     QJsonObject json;
     json["size"] = size;
     json["depth"] = depth;
+    json["sizeOverridden"] = sizeOverridden;
+    json["depthOverridden"] = depthOverridden;
     return json;
 }
 
@@ -63,6 +84,9 @@ SuctionInfo SuctionInfo::fromJson(const QJsonObject& json)
     SuctionInfo suction;
     suction.size = json["size"].toInt();
     suction.depth = json["depth"].toString();
+    // Cases saved before auto-fill hold hand-entered values
+    suction.sizeOverridden = json["sizeOverridden"].toBool(true);
+    suction.depthOverridden = json["depthOverridden"].toBool(!suction.depth.isEmpty());
     return suction;
 }
 
@@ -84,73 +108,93 @@ DecisionBox DecisionBox::fromJson(const QJsonObject& json)
     return decision;
 }
 
+namespace {
+
+// Blank cases share one payload until they are first modified
+const QSharedDataPointer<CaseData>& sharedBlankData()
+{
+    static const QSharedDataPointer<CaseData> blank(new CaseData);
+    return blank;
+}
+
+}
+
 Case::Case()
-    : id(QUuid::createUuid().toString(QUuid::WithoutBraces))
-    , caseType(CaseType::Tracheostomy)
-    , createdAt(QDateTime::currentDateTime())
-    , updatedAt(QDateTime::currentDateTime())
+    : d(sharedBlankData())
 {
 }
 
 Case::Case(const QString& id, CaseType type)
-    : id(id)
-    , caseType(type)
-    , createdAt(QDateTime::currentDateTime())
-    , updatedAt(QDateTime::currentDateTime())
+    : d(new CaseData)
 {
+    d->id = id;
+    d->caseType = type;
+    d->createdAt = QDateTime::currentDateTime();
+    d->updatedAt = d->createdAt;
+}
+
+Case Case::createNew(CaseType type)
+{
+    Case case_(QUuid::createUuid().toString(QUuid::WithoutBraces), type);
+
+    // Matches the suction size a blank form starts with
+    SuctionInfo suction;
+    suction.size = 6;
+    case_.setSuction(suction);
+    return case_;
 }
 
 QString Case::getCaseTypeString() const
 {
-    switch (caseType) {
+    switch (d->caseType) {
     case CaseType::Tracheostomy:
-        return "tracheostomy";
+        return QStringLiteral("tracheostomy");
     case CaseType::NewTracheostomy:
-        return "new_tracheostomy";
+        return QStringLiteral("new_tracheostomy");
     case CaseType::DifficultAirway:
-        return "difficult_airway";
+        return QStringLiteral("difficult_airway");
     case CaseType::LTR:
-        return "ltr";
+        return QStringLiteral("ltr");
     }
-    return "tracheostomy";
+    return QStringLiteral("tracheostomy");
 }
 
 CaseType Case::caseTypeFromString(const QString& str)
 {
-    if (str == "tracheostomy") return CaseType::Tracheostomy;
-    if (str == "new_tracheostomy") return CaseType::NewTracheostomy;
-    if (str == "difficult_airway") return CaseType::DifficultAirway;
-    if (str == "ltr") return CaseType::LTR;
+    if (str == QLatin1String("tracheostomy")) return CaseType::Tracheostomy;
+    if (str == QLatin1String("new_tracheostomy")) return CaseType::NewTracheostomy;
+    if (str == QLatin1String("difficult_airway")) return CaseType::DifficultAirway;
+    if (str == QLatin1String("ltr")) return CaseType::LTR;
     return CaseType::Tracheostomy;
 }
 
 QJsonObject Case::toJson() const
 {
     QJsonObject json;
-    json["id"] = id;
+    json["id"] = d->id;
     json["caseType"] = getCaseTypeString();
-    json["patient"] = patient.toJson();
+    json["patient"] = d->patient.toJson();
     
     QJsonArray specArray;
-    for (const auto& row : specTable) {
+    for (const auto& row : d->specTable) {
         specArray.append(row.toJson());
     }
     json["specTable"] = specArray;
     
-    json["suction"] = suction.toJson();
-    json["decisionBox"] = decisionBox.toJson();
-    json["emergencyScenario"] = emergencyScenario;
-    json["specialComments"] = specialComments;
-    json["createdAt"] = createdAt.toString(Qt::ISODate);
-    json["updatedAt"] = updatedAt.toString(Qt::ISODate);
+    json["suction"] = d->suction.toJson();
+    json["decisionBox"] = d->decisionBox.toJson();
+    json["emergencyScenario"] = d->emergencyScenario;
+    json["specialComments"] = d->specialComments;
+    json["createdAt"] = d->createdAt.toString(Qt::ISODate);
+    json["updatedAt"] = d->updatedAt.toString(Qt::ISODate);
     
-    json["surgeon"] = surgeon;
-    json["dateOfSurgery"] = dateOfSurgery;
-    json["firstTrachChange"] = firstTrachChange;
-    json["airwayDiagnosis"] = airwayDiagnosis;
-    json["procedure"] = procedure;
-    json["extubationDate"] = extubationDate;
-    json["trachIndication"] = trachIndication;
+    json["surgeon"] = d->surgeon;
+    json["dateOfSurgery"] = d->dateOfSurgery;
+    json["firstTrachChange"] = d->firstTrachChange;
+    json["airwayDiagnosis"] = d->airwayDiagnosis;
+    json["procedure"] = d->procedure;
+    json["extubationDate"] = d->extubationDate;
+    json["trachIndication"] = d->trachIndication;
     // Note: filePath is not saved to JSON to avoid circular references
 
     return json;
@@ -159,29 +203,30 @@ QJsonObject Case::toJson() const
 Case Case::fromJson(const QJsonObject& json)
 {
     Case case_;
-    case_.id = json["id"].toString();
-    case_.caseType = caseTypeFromString(json["caseType"].toString());
-    case_.patient = PatientInfo::fromJson(json["patient"].toObject());
+    CaseData& data = *case_.d; // Detaches once from the shared blank payload
+    data.id = json["id"].toString();
+    data.caseType = caseTypeFromString(json["caseType"].toString());
+    data.patient = PatientInfo::fromJson(json["patient"].toObject());
     
     QJsonArray specArray = json["specTable"].toArray();
     for (const auto& value : specArray) {
-        case_.specTable.append(SpecificationTableRow::fromJson(value.toObject()));
+        data.specTable.append(SpecificationTableRow::fromJson(value.toObject()));
     }
     
-    case_.suction = SuctionInfo::fromJson(json["suction"].toObject());
-    case_.decisionBox = DecisionBox::fromJson(json["decisionBox"].toObject());
-    case_.emergencyScenario = json["emergencyScenario"].toString();
-    case_.specialComments = json["specialComments"].toString();
-    case_.createdAt = QDateTime::fromString(json["createdAt"].toString(), Qt::ISODate);
-    case_.updatedAt = QDateTime::fromString(json["updatedAt"].toString(), Qt::ISODate);
+    data.suction = SuctionInfo::fromJson(json["suction"].toObject());
+    data.decisionBox = DecisionBox::fromJson(json["decisionBox"].toObject());
+    data.emergencyScenario = json["emergencyScenario"].toString();
+    data.specialComments = json["specialComments"].toString();
+    data.createdAt = QDateTime::fromString(json["createdAt"].toString(), Qt::ISODate);
+    data.updatedAt = QDateTime::fromString(json["updatedAt"].toString(), Qt::ISODate);
     
-    case_.surgeon = json["surgeon"].toString();
-    case_.dateOfSurgery = json["dateOfSurgery"].toString();
-    case_.firstTrachChange = json["firstTrachChange"].toString();
-    case_.airwayDiagnosis = json["airwayDiagnosis"].toString();
-    case_.procedure = json["procedure"].toString();
-    case_.extubationDate = json["extubationDate"].toString();
-    case_.trachIndication = json["trachIndication"].toString();
+    data.surgeon = json["surgeon"].toString();
+    data.dateOfSurgery = json["dateOfSurgery"].toString();
+    data.firstTrachChange = json["firstTrachChange"].toString();
+    data.airwayDiagnosis = json["airwayDiagnosis"].toString();
+    data.procedure = json["procedure"].toString();
+    data.extubationDate = json["extubationDate"].toString();
+    data.trachIndication = json["trachIndication"].toString();
     // Note: filePath is set by CaseManager after loading
 
     return case_;
@@ -6,6 +6,9 @@
 #include <QJsonArray>
 #include <QDateTime>
 #include <QList>
+#include <QSharedData>
+#include <QSharedDataPointer>
+#include "TubeVocabulary.h"
 
 enum class CaseType {
     Tracheostomy,
@@ -14,18 +17,42 @@ enum class CaseType {
     LTR
 };
 
+// Manufacturer, size, line and cuff are TubeVocabulary ids, so standard
+// values compare and index as integers. Custom entries are CustomId, and only
+// they keep their text, in the row itself.
 struct SpecificationTableRow {
-    QString makeModel;
-    QString size;
-    QString type;
-    QString cuff;
-    double innerDiameter;
-    double outerDiameter;
-    double length;
-    int reorderNumber;
-    
+    quint32 makeModelId = 0;
+    quint32 sizeId = 0;
+    quint32 typeId = 0;
+    quint32 cuffId = 0;
+    QString customMakeModel;
+    QString customSize;
+    QString customType;
+    QString customCuff;
+    double innerDiameter = 0.0;
+    double outerDiameter = 0.0;
+    double length = 0.0;
+    int reorderNumber = 0;
+
+    QString makeModel() const { return text(TubeVocabulary::Manufacturer, makeModelId, customMakeModel); }
+    QString size() const { return text(TubeVocabulary::Size, sizeId, customSize); }
+    QString type() const { return text(TubeVocabulary::Line, typeId, customType); }
+    QString cuff() const { return text(TubeVocabulary::Cuff, cuffId, customCuff); }
+
+    void setMakeModel(const QString& text) { assign(TubeVocabulary::Manufacturer, text, makeModelId, customMakeModel); }
+    void setSize(const QString& text) { assign(TubeVocabulary::Size, text, sizeId, customSize); }
+    void setType(const QString& text) { assign(TubeVocabulary::Line, text, typeId, customType); }
+    void setCuff(const QString& text) { assign(TubeVocabulary::Cuff, text, cuffId, customCuff); }
+
+    TubeManufacturer manufacturer() const;
+    bool hasSize() const { return sizeId != 0; }
+
     QJsonObject toJson() const;
     static SpecificationTableRow fromJson(const QJsonObject& json);
+
+private:
+    static QString text(TubeVocabulary::Field field, quint32 id, const QString& custom);
+    static void assign(TubeVocabulary::Field field, const QString& text, quint32& id, QString& custom);
 };
 
 struct PatientInfo {
@@ -39,106 +66,121 @@ struct PatientInfo {
 };
 
 struct SuctionInfo {
-    int size;
+    int size = 0;
     QString depth;
+    // Set once staff change a value the tube recommendation filled in
+    bool sizeOverridden = false;
+    bool depthOverridden = false;
     
     QJsonObject toJson() const;
     static SuctionInfo fromJson(const QJsonObject& json);
 };
 
 struct DecisionBox {
-    bool maskVentilate;
-    bool intubateAbove;
-    bool intubateStoma;
+    bool maskVentilate = false;
+    bool intubateAbove = false;
+    bool intubateStoma = false;
     
     QJsonObject toJson() const;
     static DecisionBox fromJson(const QJsonObject& json);
 };
 
+// Shared payload behind Case; copied only when a shared Case is modified
+class CaseData : public QSharedData
+{
+public:
+    QString id;
+    CaseType caseType = CaseType::Tracheostomy;
+    PatientInfo patient;
+    QList<SpecificationTableRow> specTable;
+    SuctionInfo suction;
+    DecisionBox decisionBox;
+    QString emergencyScenario;
+    QString specialComments;
+    QDateTime createdAt;
+    QDateTime updatedAt;
+
+    QString surgeon;
+    QString dateOfSurgery;
+    QString firstTrachChange;
+    QString airwayDiagnosis;
+    QString procedure;
+    QString extubationDate;
+    QString trachIndication;
+    QString filePath;
+};
+
+// Implicitly shared: copies are cheap and share data until one is modified.
+// A default-constructed Case is blank; use createNew() for a case that needs
+// a fresh id and timestamps.
 class Case
 {
 public:
     Case();
     Case(const QString& id, CaseType type);
+
+    static Case createNew(CaseType type);
     
-    QString getId() const { return id; }
-    void setId(const QString& newId) { id = newId; }
+    const QString& getId() const { return d->id; }
+    void setId(const QString& newId) { d->id = newId; }
     
-    CaseType getCaseType() const { return caseType; }
-    void setCaseType(CaseType type) { caseType = type; }
+    CaseType getCaseType() const { return d->caseType; }
+    void setCaseType(CaseType type) { d->caseType = type; }
     
     QString getCaseTypeString() const;
     static CaseType caseTypeFromString(const QString& str);
     
-    PatientInfo getPatient() const { return patient; }
-    void setPatient(const PatientInfo& patientInfo) { patient = patientInfo; }
+    const PatientInfo& getPatient() const { return d->patient; }
+    void setPatient(const PatientInfo& patientInfo) { d->patient = patientInfo; }
     
-    QList<SpecificationTableRow> getSpecTable() const { return specTable; }
-    void setSpecTable(const QList<SpecificationTableRow>& table) { specTable = table; }
+    const QList<SpecificationTableRow>& getSpecTable() const { return d->specTable; }
+    void setSpecTable(const QList<SpecificationTableRow>& table) { d->specTable = table; }
     
-    SuctionInfo getSuction() const { return suction; }
-    void setSuction(const SuctionInfo& suctionInfo) { suction = suctionInfo; }
+    const SuctionInfo& getSuction() const { return d->suction; }
+    void setSuction(const SuctionInfo& suctionInfo) { d->suction = suctionInfo; }
     
-    DecisionBox getDecisionBox() const { return decisionBox; }
-    void setDecisionBox(const DecisionBox& decision) { decisionBox = decision; }
+    const DecisionBox& getDecisionBox() const { return d->decisionBox; }
+    void setDecisionBox(const DecisionBox& decision) { d->decisionBox = decision; }
     
-    QString getEmergencyScenario() const { return emergencyScenario; }
-    void setEmergencyScenario(const QString& scenario) { emergencyScenario = scenario; }
+    const QString& getEmergencyScenario() const { return d->emergencyScenario; }
+    void setEmergencyScenario(const QString& scenario) { d->emergencyScenario = scenario; }
     
-    QString getSpecialComments() const { return specialComments; }
-    void setSpecialComments(const QString& comments) { specialComments = comments; }
+    const QString& getSpecialComments() const { return d->specialComments; }
+    void setSpecialComments(const QString& comments) { d->specialComments = comments; }
     
-    QDateTime getCreatedAt() const { return createdAt; }
-    QDateTime getUpdatedAt() const { return updatedAt; }
-    void setUpdatedAt(const QDateTime& time) { updatedAt = time; }
+    const QDateTime& getCreatedAt() const { return d->createdAt; }
+    const QDateTime& getUpdatedAt() const { return d->updatedAt; }
+    void setUpdatedAt(const QDateTime& time) { d->updatedAt = time; }
     
-    QString getSurgeon() const { return surgeon; }
-    void setSurgeon(const QString& surgeonName) { surgeon = surgeonName; }
+    const QString& getSurgeon() const { return d->surgeon; }
+    void setSurgeon(const QString& surgeonName) { d->surgeon = surgeonName; }
     
-    QString getDateOfSurgery() const { return dateOfSurgery; }
-    void setDateOfSurgery(const QString& date) { dateOfSurgery = date; }
+    const QString& getDateOfSurgery() const { return d->dateOfSurgery; }
+    void setDateOfSurgery(const QString& date) { d->dateOfSurgery = date; }
     
-    QString getFirstTrachChange() const { return firstTrachChange; }
-    void setFirstTrachChange(const QString& date) { firstTrachChange = date; }
+    const QString& getFirstTrachChange() const { return d->firstTrachChange; }
+    void setFirstTrachChange(const QString& date) { d->firstTrachChange = date; }
     
-    QString getAirwayDiagnosis() const { return airwayDiagnosis; }
-    void setAirwayDiagnosis(const QString& diagnosis) { airwayDiagnosis = diagnosis; }
+    const QString& getAirwayDiagnosis() const { return d->airwayDiagnosis; }
+    void setAirwayDiagnosis(const QString& diagnosis) { d->airwayDiagnosis = diagnosis; }
     
-    QString getProcedure() const { return procedure; }
-    void setProcedure(const QString& procedureName) { procedure = procedureName; }
+    const QString& getProcedure() const { return d->procedure; }
+    void setProcedure(const QString& procedureName) { d->procedure = procedureName; }
     
-    QString getExtubationDate() const { return extubationDate; }
-    void setExtubationDate(const QString& date) { extubationDate = date; }
+    const QString& getExtubationDate() const { return d->extubationDate; }
+    void setExtubationDate(const QString& date) { d->extubationDate = date; }
     
-    QString getTrachIndication() const { return trachIndication; }
-    void setTrachIndication(const QString& indication) { trachIndication = indication; }
+    const QString& getTrachIndication() const { return d->trachIndication; }
+    void setTrachIndication(const QString& indication) { d->trachIndication = indication; }
 
-    QString getFilePath() const { return filePath; }
-    void setFilePath(const QString& path) { filePath = path; }
+    const QString& getFilePath() const { return d->filePath; }
+    void setFilePath(const QString& path) { d->filePath = path; }
 
     QJsonObject toJson() const;
     static Case fromJson(const QJsonObject& json);
     
 private:
-    QString id;
-    CaseType caseType;
-    PatientInfo patient;
-    QList<SpecificationTableRow> specTable;
-    SuctionInfo suction;
-    DecisionBox decisionBox;
-    QString emergencyScenario;
-    QString specialComments;
-    QDateTime createdAt;
-    QDateTime updatedAt;
-    
-    QString surgeon;
-    QString dateOfSurgery;
-    QString firstTrachChange;
-    QString airwayDiagnosis;
-    QString procedure;
-    QString extubationDate;
-    QString trachIndication;
-    QString filePath;
+    QSharedDataPointer<CaseData> d;
 };
 
 #endif // CASE_H
\ No newline at end of file
@@ -62,7 +62,7 @@ QList<EmergencyScenario> EmergencyScenario::getDefaultScenarios()
         "Call for help immediately",
         "Check tracheostomy tube patency",
         "Attempt bag-mask ventilation above stoma",
-        "Consider 6.0 endotracheal tube insertion",
+        "Consider {ettSize} endotracheal tube insertion",
         "Prepare for emergency surgical intervention"
     }));
     
@@ -79,7 +79,7 @@ QList<EmergencyScenario> EmergencyScenario::getDefaultScenarios()
         "Cover stoma with gauze",
         "Attempt reinsertion with same size tube",
         "If unsuccessful, try smaller tube",
-        "Consider 6.0 endotracheal tube if needed",
+        "Consider {ettSize} endotracheal tube if needed",
         "Prepare for emergency surgical intervention"
     }));
     
@@ -92,15 +92,4 @@ QList<EmergencyScenario> EmergencyScenario::getDefaultScenarios()
     }));
     
     return scenarios;
-}
-
-EmergencyScenario EmergencyScenario::getScenarioByName(const QString& name)
-{
-    auto scenarios = getDefaultScenarios();
-    for (const auto& scenario : scenarios) {
-        if (scenario.getName() == name) {
-            return scenario;
-        }
-    }
-    return EmergencyScenario();
 }
\ No newline at end of file
@@ -23,8 +23,9 @@ public:
     QJsonObject toJson() const;
     static EmergencyScenario fromJson(const QJsonObject& json);
     
+    // Instructions may contain parameter slots such as {ettSize};
+    // EmergencyScenarioRegistry renders them for a case
     static QList<EmergencyScenario> getDefaultScenarios();
-    static EmergencyScenario getScenarioByName(const QString& name);
     
 private:
     QString name;
@@ -0,0 +1,325 @@
+#include "EmergencyScenarioRegistry.h"
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+struct SlotName {
+    const char* name;
+    ScenarioTemplate::Slot slot;
+};
+
+const SlotName SLOT_NAMES[] = {
+    { "ettSize", ScenarioTemplate::EttSize },
+    { "suctionSize", ScenarioTemplate::SuctionSize },
+    { "suctionDepth", ScenarioTemplate::SuctionDepth },
+    { "tubeModel", ScenarioTemplate::TubeModel }
+};
+
+// Variant keys in emergency_protocols.json; index matches CaseType, and the
+// names match Case::getCaseTypeString
+const char* const CASE_TYPE_KEYS[] = { "tracheostomy", "new_tracheostomy", "difficult_airway", "ltr" };
+
+// Rough width of a rendered slot, only used to size the output up front
+const int SLOT_RESERVE = 8;
+
+}
+
+ScenarioParameters ScenarioParameters::fromSuctionSize(int suctionSize)
+{
+    ScenarioParameters parameters;
+    if (suctionSize > 0) {
+        parameters.ettSizeTenths = suctionSize * 10;
+    }
+    parameters.suctionSizeFr = suctionSize;
+    return parameters;
+}
+
+ScenarioParameters ScenarioParameters::fromCase(const Case& case_)
+{
+    const SuctionInfo& suction = case_.getSuction();
+    const QList<SpecificationTableRow>& specs = case_.getSpecTable();
+    if (specs.isEmpty()) {
+        return fromFields(suction.size, suction.depth, QString(), QString(), QString());
+    }
+
+    const SpecificationTableRow& spec = specs.first();
+    return fromFields(suction.size, suction.depth, spec.makeModel(), spec.type(), spec.size());
+}
+
+ScenarioParameters ScenarioParameters::fromFields(int suctionSize, const QString& suctionDepth,
+                                                  const QString& makeModel, const QString& type, const QString& size)
+{
+    ScenarioParameters parameters = fromSuctionSize(suctionSize);
+    parameters.suctionDepth = suctionDepth;
+    parameters.tubeModel = QStringList({ makeModel, type, size }).join(' ').simplified();
+    return parameters;
+}
+
+ScenarioTemplate ScenarioTemplate::compile(const QStringList& instructions, QString* unknownSlot)
+{
+    ScenarioTemplate compiled;
+    QString literal;
+
+    auto flushLiteral = [&compiled, &literal]() {
+        if (literal.isEmpty()) return;
+        compiled.literalLength_ += literal.size();
+        compiled.tokens_.append({ Literal, literal });
+        literal.clear();
+    };
+
+    for (int i = 0; i < instructions.size(); ++i) {
+        if (i > 0) {
+            literal += '\n';
+        }
+        literal += QString("%1. ").arg(i + 1);
+
+        const QString& instruction = instructions[i];
+        int pos = 0;
+        while (pos < instruction.size()) {
+            const int open = instruction.indexOf('{', pos);
+            const int close = open < 0 ? -1 : instruction.indexOf('}', open + 1);
+            if (close < 0) {
+                literal += instruction.mid(pos);
+                break;
+            }
+
+            literal += instruction.mid(pos, open - pos);
+            const QStringView name = QStringView(instruction).mid(open + 1, close - open - 1);
+
+            Slot slot = Literal;
+            for (const SlotName& slotName : SLOT_NAMES) {
+                if (name == QLatin1String(slotName.name)) {
+                    slot = slotName.slot;
+                    break;
+                }
+            }
+
+            if (slot == Literal) {
+                // Not a parameter; keep the braces as written
+                if (unknownSlot && unknownSlot->isEmpty()) {
+                    *unknownSlot = name.toString();
+                }
+                literal += instruction.mid(open, close - open + 1);
+            } else {
+                flushLiteral();
+                compiled.tokens_.append({ slot, QString() });
+            }
+            pos = close + 1;
+        }
+    }
+
+    // Matches the old trimmed() output
+    while (!literal.isEmpty() && literal.back().isSpace()) {
+        literal.chop(1);
+    }
+    flushLiteral();
+    return compiled;
+}
+
+QString ScenarioTemplate::render(const ScenarioParameters& parameters) const
+{
+    QString rendered;
+    rendered.reserve(literalLength_ + tokens_.size() * SLOT_RESERVE);
+
+    for (const Token& token : tokens_) {
+        switch (token.slot) {
+        case Literal:
+            rendered += token.text;
+            break;
+        case EttSize:
+            rendered += QString::number(parameters.ettSizeTenths / 10.0, 'f', 1);
+            break;
+        case SuctionSize:
+            rendered += QString::number(parameters.suctionSizeFr);
+            break;
+        case SuctionDepth:
+            rendered += parameters.suctionDepth;
+            break;
+        case TubeModel:
+            rendered += parameters.tubeModel;
+            break;
+        }
+    }
+    return rendered;
+}
+
+std::atomic<const EmergencyScenarioRegistry*> EmergencyScenarioRegistry::current_(nullptr);
+
+EmergencyScenarioRegistry::EmergencyScenarioRegistry()
+    : revision_(0)
+{
+}
+
+const EmergencyScenarioRegistry& EmergencyScenarioRegistry::builtIn()
+{
+    // Function-local so the first use from a print worker is also safe
+    static const EmergencyScenarioRegistry* registry = []() {
+        EmergencyScenarioRegistry* defaults = new EmergencyScenarioRegistry();
+        const QList<EmergencyScenario> scenarios = EmergencyScenario::getDefaultScenarios();
+        for (const EmergencyScenario& scenario : scenarios) {
+            defaults->add(scenario, ScenarioTemplate::compile(scenario.getInstructions()), 0);
+        }
+        return defaults;
+    }();
+    return *registry;
+}
+
+const EmergencyScenarioRegistry& EmergencyScenarioRegistry::instance()
+{
+    const EmergencyScenarioRegistry* current = current_.load(std::memory_order_acquire);
+    return current ? *current : builtIn();
+}
+
+void EmergencyScenarioRegistry::publish(const EmergencyScenarioRegistry* registry)
+{
+    current_.store(registry, std::memory_order_release);
+}
+
+void EmergencyScenarioRegistry::add(const EmergencyScenario& scenario, const ScenarioTemplate& compiled, int variant)
+{
+    const int existing = lookup(scenario.getName(), variant);
+    if (existing >= 0) {
+        scenarios_[existing] = scenario;
+        templates_[existing] = compiled;
+        return;
+    }
+
+    index_[variant].insert(scenario.getName(), scenarios_.size());
+    scenarios_.append(scenario);
+    templates_.append(compiled);
+    if (variant == 0) {
+        names_.append(scenario.getName());
+    }
+}
+
+int EmergencyScenarioRegistry::lookup(const QString& name, int variant) const
+{
+    return index_[variant].value(name, -1);
+}
+
+const EmergencyScenario* EmergencyScenarioRegistry::find(const QString& name, CaseType caseType) const
+{
+    int index = lookup(name, variantOf(caseType));
+    if (index < 0) {
+        index = lookup(name, 0);
+    }
+    return index >= 0 ? &scenarios_[index] : nullptr;
+}
+
+const EmergencyScenario* EmergencyScenarioRegistry::find(const QString& name) const
+{
+    const int index = lookup(name, 0);
+    return index >= 0 ? &scenarios_[index] : nullptr;
+}
+
+QString EmergencyScenarioRegistry::render(const QString& name, CaseType caseType,
+                                          const ScenarioParameters& parameters) const
+{
+    int index = lookup(name, variantOf(caseType));
+    if (index < 0) {
+        index = lookup(name, 0);
+    }
+    return index >= 0 ? templates_[index].render(parameters) : QString();
+}
+
+QString EmergencyScenarioRegistry::render(const QString& name, const ScenarioParameters& parameters) const
+{
+    const int index = lookup(name, 0);
+    return index >= 0 ? templates_[index].render(parameters) : QString();
+}
+
+std::unique_ptr<EmergencyScenarioRegistry> EmergencyScenarioRegistry::fromJson(const QByteArray& data,
+                                                                               QString& errorMessage)
+{
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(data, &parseError);
+    if (!doc.isObject()) {
+        errorMessage = parseError.error != QJsonParseError::NoError ? parseError.errorString()
+                                                                    : QString("expected a JSON object");
+        return nullptr;
+    }
+
+    const QJsonObject root = doc.object();
+    const int formatVersion = root.value("formatVersion").toInt(0);
+    if (formatVersion != FormatVersion) {
+        errorMessage = QString("unsupported formatVersion %1 (expected %2)").arg(formatVersion).arg(FormatVersion);
+        return nullptr;
+    }
+
+    // Start from the built-in protocols so the file only lists what changes
+    std::unique_ptr<EmergencyScenarioRegistry> registry(new EmergencyScenarioRegistry());
+    const EmergencyScenarioRegistry& defaults = builtIn();
+    for (int i = 0; i < defaults.scenarios_.size(); ++i) {
+        registry->add(defaults.scenarios_[i], defaults.templates_[i], 0);
+    }
+    registry->revision_ = root.value("revision").toInt(1);
+
+    // Validates and compiles one instruction list
+    auto compileInstructions = [&errorMessage](const QJsonValue& value, const QString& where,
+                                               QStringList& instructions, ScenarioTemplate& compiled) {
+        const QJsonArray array = value.toArray();
+        if (!value.isArray() || array.isEmpty()) {
+            errorMessage = where + ": instructions must be a non-empty list";
+            return false;
+        }
+        for (const QJsonValue& line : array) {
+            if (!line.isString() || line.toString().trimmed().isEmpty()) {
+                errorMessage = where + ": every instruction must be non-empty text";
+                return false;
+            }
+            instructions.append(line.toString());
+        }
+
+        QString unknownSlot;
+        compiled = ScenarioTemplate::compile(instructions, &unknownSlot);
+        if (!unknownSlot.isEmpty()) {
+            errorMessage = QString("%1: unknown parameter {%2}").arg(where, unknownSlot);
+            return false;
+        }
+        return true;
+    };
+
+    const QJsonArray scenarios = root.value("scenarios").toArray();
+    for (const QJsonValue& value : scenarios) {
+        const QJsonObject object = value.toObject();
+        const QString name = object.value("name").toString();
+
+        // The overlay has a button for each built-in scenario and no others
+        if (!defaults.find(name)) {
+            errorMessage = QString("unknown scenario \"%1\"").arg(name);
+            return nullptr;
+        }
+
+        if (object.contains("instructions")) {
+            QStringList instructions;
+            ScenarioTemplate compiled;
+            if (!compileInstructions(object.value("instructions"), name, instructions, compiled)) {
+                return nullptr;
+            }
+            registry->add(EmergencyScenario(name, instructions), compiled, 0);
+        }
+
+        const QJsonObject variants = object.value("variants").toObject();
+        for (auto it = variants.begin(); it != variants.end(); ++it) {
+            const auto typeIt = std::find_if(std::begin(CASE_TYPE_KEYS), std::end(CASE_TYPE_KEYS),
+                [&it](const char* key) { return it.key() == QLatin1String(key); });
+            if (typeIt == std::end(CASE_TYPE_KEYS)) {
+                errorMessage = QString("%1: unknown case type \"%2\"").arg(name, it.key());
+                return nullptr;
+            }
+
+            QStringList instructions;
+            ScenarioTemplate compiled;
+            if (!compileInstructions(it.value(), name + " (" + it.key() + ")", instructions, compiled)) {
+                return nullptr;
+            }
+            const CaseType caseType = CaseType(typeIt - std::begin(CASE_TYPE_KEYS));
+            registry->add(EmergencyScenario(name, instructions), compiled, variantOf(caseType));
+        }
+    }
+
+    return registry;
+}
@@ -0,0 +1,120 @@
+#ifndef EMERGENCYSCENARIOREGISTRY_H
+#define EMERGENCYSCENARIOREGISTRY_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+#include <atomic>
+#include <memory>
+#include "EmergencyScenario.h"
+#include "Case.h"
+
+// Case values an instruction can refer to as {ettSize}, {suctionSize},
+// {suctionDepth} or {tubeModel}
+struct ScenarioParameters {
+    int ettSizeTenths = 60;
+    int suctionSizeFr = 0;
+    QString suctionDepth;
+    QString tubeModel;
+
+    // The ETT size follows the suction catheter size (8 Fr -> 8.0)
+    static ScenarioParameters fromSuctionSize(int suctionSize);
+    static ScenarioParameters fromCase(const Case& case_);
+    // The same values read straight from a form's fields
+    static ScenarioParameters fromFields(int suctionSize, const QString& suctionDepth,
+                                         const QString& makeModel, const QString& type, const QString& size);
+
+    bool operator==(const ScenarioParameters& other) const {
+        return ettSizeTenths == other.ettSizeTenths && suctionSizeFr == other.suctionSizeFr
+            && suctionDepth == other.suctionDepth && tubeModel == other.tubeModel;
+    }
+    bool operator!=(const ScenarioParameters& other) const { return !(*this == other); }
+};
+
+// Numbered instructions compiled into literal runs and parameter slots, so
+// rendering is one pass over the tokens with no searching
+class ScenarioTemplate
+{
+public:
+    enum Slot : quint8 {
+        Literal = 0,
+        EttSize,
+        SuctionSize,
+        SuctionDepth,
+        TubeModel
+    };
+
+    // unknownSlot, if given, receives the first {name} that is not a slot
+    static ScenarioTemplate compile(const QStringList& instructions, QString* unknownSlot = nullptr);
+
+    QString render(const ScenarioParameters& parameters) const;
+
+private:
+    struct Token {
+        Slot slot;
+        QString text;   // Literal only
+    };
+
+    QVector<Token> tokens_;
+    int literalLength_ = 0;
+};
+
+// One set of compiled emergency protocols: the built-in defaults, or
+// emergency_protocols.json laid over them. A set is never modified once it
+// is published, so readers only load a pointer and never wait, from any
+// thread, including while a new set is being loaded.
+class EmergencyScenarioRegistry
+{
+public:
+    static const int FormatVersion = 1;
+
+    // The set currently in use
+    static const EmergencyScenarioRegistry& instance();
+
+    // nullptr goes back to the built-in set. The caller keeps a published
+    // set alive for the rest of the process, since readers may hold it.
+    static void publish(const EmergencyScenarioRegistry* registry);
+
+    // Protocol file contents laid over the built-in set; nullptr and a
+    // message when the file is not valid
+    static std::unique_ptr<EmergencyScenarioRegistry> fromJson(const QByteArray& data, QString& errorMessage);
+
+    // The case type's variant when there is one, else the general protocol.
+    // nullptr for an unknown name.
+    const EmergencyScenario* find(const QString& name, CaseType caseType) const;
+    const EmergencyScenario* find(const QString& name) const;
+    QStringList names() const { return names_; }
+
+    // Empty for an unknown name
+    QString render(const QString& name, CaseType caseType, const ScenarioParameters& parameters) const;
+    QString render(const QString& name, const ScenarioParameters& parameters) const;
+
+    // From the protocol file, 0 for the built-in set
+    int revision() const { return revision_; }
+
+private:
+    // Variant 0 is the general protocol, then one per CaseType
+    static const int VariantCount = 5;
+
+    EmergencyScenarioRegistry();
+    EmergencyScenarioRegistry(const EmergencyScenarioRegistry&) = delete;
+    EmergencyScenarioRegistry& operator=(const EmergencyScenarioRegistry&) = delete;
+
+    static const EmergencyScenarioRegistry& builtIn();
+    static int variantOf(CaseType caseType) { return int(caseType) + 1; }
+
+    // Adds the scenario, or replaces one of the same name and variant
+    void add(const EmergencyScenario& scenario, const ScenarioTemplate& compiled, int variant);
+    int lookup(const QString& name, int variant) const;
+
+    static std::atomic<const EmergencyScenarioRegistry*> current_;
+
+    QList<EmergencyScenario> scenarios_;
+    QVector<ScenarioTemplate> templates_;
+    QHash<QString, int> index_[VariantCount];
+    QStringList names_;
+    int revision_;
+};
+
+#endif // EMERGENCYSCENARIOREGISTRY_H
@@ -0,0 +1,55 @@
+#include "TubeVocabulary.h"
+#include "utils/SATrachTube.h"
+
+TubeVocabulary& TubeVocabulary::instance()
+{
+    // Function-local so the first use from a loader thread is also safe
+    static TubeVocabulary vocabulary;
+    return vocabulary;
+}
+
+TubeVocabulary::TubeVocabulary()
+{
+    // Manufacturer ids line up with TubeManufacturer
+    seed(Manufacturer, {"Bivona", "Shiley", "Tracoe", "Custom"});
+
+    seed(Line, SATrachTube::BivonaTrachTypes + SATrachTube::ShileyTrachTypes
+               + SATrachTube::ShileyExtendedTypes + SATrachTube::TracoeTypes
+               + QStringList{"Neonatal", "Pediatric", "Pediatric Plus", "Extra Long", "Flextend"});
+
+    seed(Cuff, SATrachTube::BivonaCuffTypes + SATrachTube::ShileyCuffTypes
+               + SATrachTube::TracoeCuffTypes + SATrachTube::GenericCuffTypes
+               + QStringList{"Uncuffed"});
+
+    seed(Size, SATrachTube::TrachSizes + SATrachTube::ShiPedXExtraLongTrachSizes);
+}
+
+void TubeVocabulary::seed(Field field, const QStringList& values)
+{
+    Pool& pool = pools_[field];
+    pool.strings.append(QString());
+    pool.ids.insert(QString(), 0);
+
+    for (const QString& value : values) {
+        if (!pool.ids.contains(value)) {
+            pool.ids.insert(value, quint32(pool.strings.size()));
+            pool.strings.append(value);
+        }
+    }
+}
+
+quint32 TubeVocabulary::id(Field field, const QString& text) const
+{
+    return pools_[field].ids.value(text, CustomId);
+}
+
+QString TubeVocabulary::text(Field field, quint32 id) const
+{
+    const Pool& pool = pools_[field];
+    return id < quint32(pool.strings.size()) ? pool.strings.at(int(id)) : QString();
+}
+
+bool TubeVocabulary::isStandard(Field field, quint32 id) const
+{
+    return id > 0 && id < quint32(pools_[field].strings.size());
+}
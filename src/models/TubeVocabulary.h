@@ -0,0 +1,60 @@
+#ifndef TUBEVOCABULARY_H
+#define TUBEVOCABULARY_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+
+// Manufacturers the tube form offers; the value is also the manufacturer id
+enum class TubeManufacturer : quint8 {
+    None = 0,
+    Bivona,
+    Shiley,
+    Tracoe,
+    Custom,
+    Other       // Free text that is not one of the above
+};
+
+// Ids for the free-text fields of a tube specification. Values from the
+// SATrachTube vocabularies get fixed small ids; anything else is CustomId and
+// its text stays with the row that uses it. Id 0 is always the empty string.
+// Nothing is added after construction, so it is safe to use from any thread.
+class TubeVocabulary
+{
+public:
+    static constexpr quint32 CustomId = 0xffffffffu;
+
+    enum Field {
+        Manufacturer = 0,
+        Line,
+        Cuff,
+        Size,
+        FieldCount
+    };
+
+    static TubeVocabulary& instance();
+
+    // CustomId for text outside the vocabulary
+    quint32 id(Field field, const QString& text) const;
+    // Empty for CustomId
+    QString text(Field field, quint32 id) const;
+
+    // True for ids seeded from the standard vocabulary
+    bool isStandard(Field field, quint32 id) const;
+
+private:
+    TubeVocabulary();
+    TubeVocabulary(const TubeVocabulary&) = delete;
+    TubeVocabulary& operator=(const TubeVocabulary&) = delete;
+
+    struct Pool {
+        QStringList strings;
+        QHash<QString, quint32> ids;
+    };
+
+    void seed(Field field, const QStringList& values);
+
+    Pool pools_[FieldCount];
+};
+
+#endif // TUBEVOCABULARY_H
@@ -0,0 +1,278 @@
+#include "CasePrintLayout.h"
+#include "models/EmergencyScenarioRegistry.h"
+#include "utils/StyleManager.h"
+#include <QPainter>
+#include <QPen>
+#include <QFontMetricsF>
+#include <QGuiApplication>
+#include <QPair>
+
+namespace {
+
+const qreal PAGE_WIDTH = 1020.0;
+const qreal PAGE_HEIGHT = 770.0;
+const qreal HEADER_HEIGHT = 70.0;
+const qreal COLUMN_GAP = 40.0;
+const qreal SECTION_GAP = 24.0;
+const qreal ROW_GAP = 6.0;
+const qreal LABEL_WIDTH = 190.0;
+const qreal TEXT_INSET = 16.0;
+
+typedef QList<QPair<QString, QString>> FieldRows;
+
+QFont makeFont(int pixelSize, bool bold)
+{
+    QFont font = QGuiApplication::font();
+    font.setPixelSize(pixelSize);
+    font.setBold(bold);
+    return font;
+}
+
+QString formatMillimetres(double value)
+{
+    return value > 0.0 ? QString("%1 mm").arg(value, 0, 'f', 1) : QString();
+}
+
+QString caseTitle(CaseType type)
+{
+    switch (type) {
+    case CaseType::Tracheostomy:
+        return "TRACHEOSTOMY";
+    case CaseType::NewTracheostomy:
+        return "NEW TRACHEOSTOMY";
+    case CaseType::DifficultAirway:
+        return "DIFFICULT AIRWAY";
+    case CaseType::LTR:
+        return "LARYNGOTRACHEAL RECONSTRUCTION (LTR)";
+    }
+    return QString();
+}
+
+FieldRows caseDetailRows(const Case& printCase)
+{
+    switch (printCase.getCaseType()) {
+    case CaseType::Tracheostomy:
+        return { {"Trach Indication", printCase.getTrachIndication()} };
+    case CaseType::NewTracheostomy:
+        return { {"Trach Indication", printCase.getTrachIndication()},
+                 {"Surgeon", printCase.getSurgeon()},
+                 {"Date of Surgery", printCase.getDateOfSurgery()},
+                 {"First Trach Change", printCase.getFirstTrachChange()} };
+    case CaseType::DifficultAirway:
+        return { {"Airway Diagnosis", printCase.getAirwayDiagnosis()} };
+    case CaseType::LTR:
+        return { {"Procedure", printCase.getProcedure()},
+                 {"Surgeon", printCase.getSurgeon()},
+                 {"Date of Surgery", printCase.getDateOfSurgery()},
+                 {"Extubation Date", printCase.getExtubationDate()} };
+    }
+    return FieldRows();
+}
+
+// Accumulates items and measures wrapped text as it goes
+class PageBuilder
+{
+public:
+    explicit PageBuilder(const QSizeF& size)
+    {
+        page_.size = size;
+    }
+
+    // Adds wrapped text at the top of the given column and returns its height
+    qreal addText(qreal x, qreal y, qreal width, const QString& text,
+                  const QFont& font, const QColor& color, int flags = Qt::AlignLeft | Qt::AlignTop)
+    {
+        flags |= Qt::TextWordWrap;
+        QFontMetricsF metrics(font);
+        qreal height = metrics.boundingRect(QRectF(0, 0, width, 100000.0), flags, text).height();
+        height = qMax(height, metrics.height());
+
+        addTextInRect(QRectF(x, y, width, height), text, font, color, flags);
+        extendTo(y + height);
+        return height;
+    }
+
+    void addTextInRect(const QRectF& rect, const QString& text, const QFont& font,
+                       const QColor& color, int flags)
+    {
+        PrintItem item;
+        item.kind = PrintItem::Text;
+        item.rect = rect;
+        item.text = text;
+        item.font = font;
+        item.color = color;
+        item.flags = flags;
+        page_.items.append(item);
+    }
+
+    void addRect(const QRectF& rect, const QColor& color)
+    {
+        PrintItem item;
+        item.kind = PrintItem::FilledRect;
+        item.rect = rect;
+        item.color = color;
+        page_.items.append(item);
+        extendTo(rect.bottom());
+    }
+
+    void addLine(const QPointF& from, const QPointF& to, const QColor& color)
+    {
+        PrintItem item;
+        item.kind = PrintItem::Line;
+        item.rect = QRectF(from, to);
+        item.color = color;
+        page_.items.append(item);
+        extendTo(qMax(from.y(), to.y()));
+    }
+
+    PrintPage take() { return page_; }
+
+private:
+    PrintPage page_;
+
+    // Overlong content grows the page; painting scales it back to fit
+    void extendTo(qreal bottom)
+    {
+        if (bottom > page_.size.height()) {
+            page_.size.setHeight(bottom);
+        }
+    }
+};
+
+qreal addSectionTitle(PageBuilder& page, qreal x, qreal y, qreal width,
+                      const QString& title, const QColor& accent)
+{
+    qreal height = page.addText(x, y, width, title, makeFont(22, true), accent);
+    y += height + 2.0;
+    page.addLine(QPointF(x, y), QPointF(x + width, y), accent);
+    return y + ROW_GAP * 2;
+}
+
+qreal addSection(PageBuilder& page, qreal x, qreal y, qreal width,
+                 const QString& title, const FieldRows& rows, const QColor& accent)
+{
+    const QFont labelFont = makeFont(17, true);
+    const QFont valueFont = makeFont(17, false);
+
+    y = addSectionTitle(page, x, y, width, title, accent);
+    for (const auto& row : rows) {
+        qreal labelHeight = page.addText(x, y, LABEL_WIDTH, row.first + ":", labelFont, Qt::black);
+        qreal valueHeight = page.addText(x + LABEL_WIDTH, y, width - LABEL_WIDTH, row.second, valueFont, Qt::black);
+        y += qMax(labelHeight, valueHeight) + ROW_GAP;
+    }
+    return y + SECTION_GAP;
+}
+
+} // namespace
+
+QSizeF CasePrintLayout::pageSize()
+{
+    return QSizeF(PAGE_WIDTH, PAGE_HEIGHT);
+}
+
+PrintPage CasePrintLayout::layoutCase(const Case& printCase)
+{
+    PageBuilder page(pageSize());
+    const QColor accent = StyleManager::instance().getFormColour(printCase.getCaseType());
+    const qreal width = PAGE_WIDTH;
+    const qreal columnWidth = (width - COLUMN_GAP) / 2.0;
+    const qreal leftX = 0.0;
+    const qreal rightX = columnWidth + COLUMN_GAP;
+
+    // Header band in the case colour
+    page.addRect(QRectF(0, 0, width, HEADER_HEIGHT), accent);
+    page.addTextInRect(QRectF(TEXT_INSET, 0, width - 2 * TEXT_INSET, HEADER_HEIGHT),
+                       caseTitle(printCase.getCaseType()), makeFont(30, true), Qt::white,
+                       Qt::AlignLeft | Qt::AlignVCenter);
+    page.addTextInRect(QRectF(TEXT_INSET, 0, width - 2 * TEXT_INSET, HEADER_HEIGHT),
+                       "Safe Airway", makeFont(20, true), Qt::white,
+                       Qt::AlignRight | Qt::AlignVCenter);
+
+    qreal y = HEADER_HEIGHT + SECTION_GAP;
+    y += page.addText(leftX, y, width, printCase.getPatient().firstName, makeFont(44, true), Qt::black);
+    y += SECTION_GAP;
+
+    // Left column: tube, suction and case details
+    SpecificationTableRow spec = {};
+    const QList<SpecificationTableRow> specTable = printCase.getSpecTable();
+    if (!specTable.isEmpty()) {
+        spec = specTable.first();
+    }
+
+    FieldRows tubeRows = {
+        {"Manufacturer", spec.makeModel()},
+        {"Size", spec.size()},
+        {"Type", spec.type()},
+        {"Cuff", spec.cuff()},
+        {"Inner Diameter", formatMillimetres(spec.innerDiameter)},
+        {"Outer Diameter", formatMillimetres(spec.outerDiameter)},
+        {"Length", formatMillimetres(spec.length)},
+        {"Reorder #", spec.reorderNumber > 0 ? QString::number(spec.reorderNumber) : QString()}
+    };
+
+    const SuctionInfo suction = printCase.getSuction();
+    FieldRows suctionRows = {
+        {"Catheter Size", suction.size > 0 ? QString("%1 Fr").arg(suction.size) : QString()},
+        {"Suction Depth", suction.depth}
+    };
+
+    qreal leftY = addSection(page, leftX, y, columnWidth, "Tracheostomy Tube", tubeRows, accent);
+    leftY = addSection(page, leftX, leftY, columnWidth, "Suction", suctionRows, accent);
+    addSection(page, leftX, leftY, columnWidth, "Case Details", caseDetailRows(printCase), accent);
+
+    // Right column: emergency instructions, then comments
+    qreal rightY = addSectionTitle(page, rightX, y, columnWidth, "Emergency Instructions", accent);
+    const QString scenario = printCase.getEmergencyScenario();
+    if (scenario.isEmpty()) {
+        rightY += page.addText(rightX, rightY, columnWidth, "No emergency scenario selected",
+                               makeFont(17, false), Qt::darkGray);
+    } else {
+        rightY += page.addText(rightX, rightY, columnWidth, scenario.toUpper(),
+                               makeFont(20, true), QColor(220, 20, 60));
+        rightY += ROW_GAP;
+        rightY += page.addText(rightX, rightY, columnWidth,
+                               EmergencyScenarioRegistry::instance().render(scenario, printCase.getCaseType(),
+                                                                            ScenarioParameters::fromCase(printCase)),
+                               makeFont(18, false), Qt::black);
+    }
+    rightY += SECTION_GAP * 2;
+
+    rightY = addSectionTitle(page, rightX, rightY, columnWidth, "Special Comments", accent);
+    page.addText(rightX, rightY, columnWidth, printCase.getSpecialComments(), makeFont(17, false), Qt::black);
+
+    return page.take();
+}
+
+void CasePrintLayout::paintPage(QPainter* painter, const PrintPage& page, const QRectF& targetRect)
+{
+    if (!painter || page.size.isEmpty()) return;
+
+    // Uniform scale so the whole card fits the printable area
+    qreal scale = qMin(targetRect.width() / page.size.width(),
+                       targetRect.height() / page.size.height());
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setRenderHint(QPainter::TextAntialiasing);
+    painter->translate(targetRect.topLeft());
+    painter->scale(scale, scale);
+
+    for (const PrintItem& item : page.items) {
+        switch (item.kind) {
+        case PrintItem::Text:
+            painter->setFont(item.font);
+            painter->setPen(item.color);
+            painter->drawText(item.rect, item.flags, item.text);
+            break;
+        case PrintItem::FilledRect:
+            painter->fillRect(item.rect, item.color);
+            break;
+        case PrintItem::Line:
+            painter->setPen(QPen(item.color, 2.0));
+            painter->drawLine(item.rect.topLeft(), item.rect.bottomRight());
+            break;
+        }
+    }
+
+    painter->restore();
+}
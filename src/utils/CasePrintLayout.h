@@ -0,0 +1,52 @@
+#ifndef CASEPRINTLAYOUT_H
+#define CASEPRINTLAYOUT_H
+
+#include "models/Case.h"
+#include <QString>
+#include <QList>
+#include <QRectF>
+#include <QSizeF>
+#include <QFont>
+#include <QColor>
+
+class QPainter;
+
+// One primitive of a laid-out page, in page units
+struct PrintItem {
+    enum Kind {
+        Text,
+        FilledRect,
+        Line
+    };
+
+    Kind kind = Text;
+    QRectF rect;
+    QString text;
+    QFont font;
+    QColor color;
+    int flags = 0;
+};
+
+// A fully laid-out page; painting it is a straight replay of the items
+struct PrintPage {
+    QSizeF size;
+    QList<PrintItem> items;
+};
+
+// Lays out a Case as a printable card without going through any widgets.
+// Layout only touches fonts and metrics so it is safe on a worker thread;
+// painting replays vector primitives onto a printer or PDF writer.
+class CasePrintLayout
+{
+public:
+    // Landscape letter at 100 units per inch, margins excluded
+    static QSizeF pageSize();
+
+    static PrintPage layoutCase(const Case& printCase);
+    static void paintPage(QPainter* painter, const PrintPage& page, const QRectF& targetRect);
+
+private:
+    CasePrintLayout() = delete;
+};
+
+#endif // CASEPRINTLAYOUT_H
@@ -97,4 +97,24 @@ void ConfigManager::saveAutoSaveInterval(int minutes)
 int ConfigManager::getAutoSaveInterval() const
 {
     return getUserPreference("AutoSaveInterval", 5).toInt();
+}
+
+void ConfigManager::saveStallMonitorEnabled(bool enabled)
+{
+    saveUserPreference("StallMonitorEnabled", enabled);
+}
+
+bool ConfigManager::isStallMonitorEnabled() const
+{
+    return getUserPreference("StallMonitorEnabled", false).toBool();
+}
+
+void ConfigManager::saveStallThresholdMs(int thresholdMs)
+{
+    saveUserPreference("StallThresholdMs", thresholdMs);
+}
+
+int ConfigManager::getStallThresholdMs() const
+{
+    return getUserPreference("StallThresholdMs", 50).toInt();
 }
\ No newline at end of file
@@ -29,6 +29,12 @@ public:
     void saveAutoSaveInterval(int minutes);
     int getAutoSaveInterval() const;
     
+    void saveStallMonitorEnabled(bool enabled);
+    bool isStallMonitorEnabled() const;
+    
+    void saveStallThresholdMs(int thresholdMs);
+    int getStallThresholdMs() const;
+    
 private:
     ConfigManager();
     ~ConfigManager();
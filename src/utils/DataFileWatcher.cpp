@@ -0,0 +1,55 @@
+#include "DataFileWatcher.h"
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QTimer>
+
+namespace {
+
+const int QUIET_PERIOD_MS = 250;
+
+}
+
+DataFileWatcher::DataFileWatcher(QObject* parent)
+    : QObject(parent)
+    , watcher_(nullptr)
+    , quietTimer_(nullptr)
+{
+    watcher_ = new QFileSystemWatcher(this);
+    connect(watcher_, &QFileSystemWatcher::fileChanged, this, &DataFileWatcher::onPathChanged);
+    connect(watcher_, &QFileSystemWatcher::directoryChanged, this, &DataFileWatcher::onPathChanged);
+
+    quietTimer_ = new QTimer(this);
+    quietTimer_->setSingleShot(true);
+    quietTimer_->setInterval(QUIET_PERIOD_MS);
+    connect(quietTimer_, &QTimer::timeout, this, &DataFileWatcher::onQuiet);
+}
+
+void DataFileWatcher::setFilePath(const QString& filePath)
+{
+    if (!watcher_->files().isEmpty()) watcher_->removePaths(watcher_->files());
+    if (!watcher_->directories().isEmpty()) watcher_->removePaths(watcher_->directories());
+    quietTimer_->stop();
+
+    filePath_ = filePath;
+    if (filePath_.isEmpty()) return;
+
+    // The directory catches the file being created or replaced by rename
+    watcher_->addPath(QFileInfo(filePath_).absolutePath());
+    if (QFileInfo::exists(filePath_)) {
+        watcher_->addPath(filePath_);
+    }
+}
+
+void DataFileWatcher::onPathChanged()
+{
+    quietTimer_->start();
+}
+
+void DataFileWatcher::onQuiet()
+{
+    // A replaced file drops out of the watcher
+    if (QFileInfo::exists(filePath_) && !watcher_->files().contains(filePath_)) {
+        watcher_->addPath(filePath_);
+    }
+    emit changed();
+}
@@ -0,0 +1,36 @@
+#ifndef DATAFILEWATCHER_H
+#define DATAFILEWATCHER_H
+
+#include <QObject>
+#include <QString>
+
+class QFileSystemWatcher;
+class QTimer;
+
+// Watches one data file, including it being created, deleted or replaced by
+// rename, and reports a change once the file has been quiet for a moment so
+// a save that arrives as several writes is only reported once
+class DataFileWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DataFileWatcher(QObject* parent = nullptr);
+
+    void setFilePath(const QString& filePath);
+    QString filePath() const { return filePath_; }
+
+signals:
+    void changed();
+
+private slots:
+    void onPathChanged();
+    void onQuiet();
+
+private:
+    QString filePath_;
+    QFileSystemWatcher* watcher_;
+    QTimer* quietTimer_;
+};
+
+#endif // DATAFILEWATCHER_H
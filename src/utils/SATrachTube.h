@@ -1,37 +1,15 @@
 #ifndef SATRACHTUBE_H
 #define SATRACHTUBE_H
 
-#include <QMap>
 #include <QString>
 #include <QStringList>
+#include "TubeCatalog.h"
 
-// Static class with parameters for standard and custom tracheostomy tubes
+// Static class with parameters for standard and custom tracheostomy tubes.
+// Dimension tables live in TubeCatalog; these helpers keep the string API.
 class SATrachTube
 {
 public:
-    // Standard outer diameters
-    static QMap<double, double> BivonaStdOD;
-    static QMap<double, double> ShileyStdOD;
-    static QMap<double, double> ShileyExtendedStdOD;
-    static QMap<double, double> TracoeStdOD;
-
-    // Standard distal shaft lengths
-    static QMap<double, int> BivonaStdDistalShaftLenNeo; // neonatal tubes only
-    static QMap<double, int> ShileyStdDistalShaftLenNeo; // neonatal tubes only
-    static QMap<double, int> TracoeStdDistalShaftLenNeo; // neonatal tubes only
-    static QMap<double, int> BivonaStdDistalShaftLenPed; // pediatric tubes only
-    static QMap<double, int> ShileyStdDistalShaftLenPed; // pediatric tubes only
-    static QMap<double, int> TracoeStdDistalShaftLenPed; // pediatric tubes only
-    static QMap<double, int> ShileyStdDistalShaftLenPedExtraLong; // pediatric extra long tubes only
-    static QMap<double, int> BivonaStdDistalShaftLenPedPlus; // flextend pediatric plus tubes only
-    static QMap<double, int> BivonaStdProximalShaftLen; // flextend tubes only
-
-    // Standard suction catheter sizes
-    static QMap<double, int> StdSuctCathSize;
-
-    // ETT suction depths
-    static QMap<QString, QString> StdETTSuctDepth;
-
     // Constants
     static const int AdapterLen = 25; // standard length of anesthetic adaptor
     static const int SuctTipExtend = 5; // standard recommendation for suction distance beyond cannula tip
@@ -64,16 +42,16 @@ public:
     
     // Helper functions for sizing algorithms
     static double getOuterDiameter(const QString& manufacturer, double size);
+    static double getOuterDiameter(TubeManufacturer manufacturer, int sizeTenths);
     static int getSuctionCatheterSize(double trachSize);
     static QString getETTSuctionDepth(const QString& ettSize);
 
+    // Maps a manufacturer name, including Portex/Medtronic/Atos, to the catalog key
+    static TubeManufacturer manufacturerFromName(const QString& manufacturer);
+
 private:
     // Private constructor to prevent instantiation
     SATrachTube() = delete;
-
-    // Static initialization helper
-    static void initializeMaps();
-    static bool isInitialized;
 };
 
 #endif // SATRACHTUBE_H
\ No newline at end of file
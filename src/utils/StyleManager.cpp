@@ -1,4 +1,5 @@
 #include "StyleManager.h"
+#include "core/StallMonitor.h"
 #include <QApplication>
 #include <QTableWidget>
 #include <QHeaderView>
@@ -61,6 +62,7 @@ void StyleManager::applyFormStyle(QWidget* widget, CaseType caseType)
 {
     if (!widget) return;
     
+    StallMonitor::Scope scope("StyleManager::applyFormStyle");
     widget->setStyleSheet(getFormStyleSheet(caseType));
 }
 
@@ -253,6 +255,8 @@ int StyleManager::getNotificationFontSize() const
 
 void StyleManager::updateFontSizes()
 {
+    // Changing the application font repolishes every widget
+    StallMonitor::Scope scope("StyleManager::updateFontSizes");
     QFont appFont = QApplication::font();
     appFont.setPointSize(baseFontSize_);
     QApplication::setFont(appFont);
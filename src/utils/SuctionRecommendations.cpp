@@ -0,0 +1,72 @@
+#include "SuctionRecommendations.h"
+#include "SATrachTube.h"
+
+QString SuctionRecommendation::depthText() const
+{
+    return depthMm > 0 ? QString("%1 cm").arg(depthMm / 10.0, 0, 'f', 1) : QString();
+}
+
+SuctionRecommendations* SuctionRecommendations::instance_ = nullptr;
+
+SuctionRecommendations& SuctionRecommendations::instance()
+{
+    if (!instance_) {
+        instance_ = new SuctionRecommendations();
+    }
+    return *instance_;
+}
+
+SuctionRecommendations::SuctionRecommendations()
+    : QObject(nullptr)
+{
+    connect(&TubeCatalog::instance(), &TubeCatalog::catalogChanged, this, &SuctionRecommendations::rebuild);
+    rebuild();
+}
+
+SuctionRecommendation SuctionRecommendations::recommend(int variant, int sizeTenths) const
+{
+    auto it = table_.constFind(key(variant, sizeTenths));
+    if (it != table_.constEnd()) {
+        return it.value();
+    }
+
+    // Custom tubes still get the standard catheter for their size
+    SuctionRecommendation recommendation;
+    recommendation.catheterFr = TubeCatalog::suctionCatheterFr(sizeTenths);
+    return recommendation;
+}
+
+SuctionRecommendation SuctionRecommendations::recommend(TubeManufacturer manufacturer, const QString& type,
+                                                        int sizeTenths) const
+{
+    return recommend(TubeCatalog::variantFor(manufacturer, type), sizeTenths);
+}
+
+void SuctionRecommendations::rebuild()
+{
+    QHash<quint32, SuctionRecommendation> table;
+    for (int i = 0; i < TubeCatalog::variantCount(); ++i) {
+        const TubeVariant& variant = TubeCatalog::variant(i);
+        const QVector<int> sizes = TubeCatalog::sizes(variant.manufacturer);
+        for (int sizeTenths : sizes) {
+            SuctionRecommendation recommendation;
+            recommendation.catheterFr = TubeCatalog::suctionCatheterFr(sizeTenths);
+
+            const int distal = TubeCatalog::dimension(variant.manufacturer, variant.distalLine, sizeTenths);
+            if (distal > 0) {
+                const int proximal = variant.flextend
+                    ? TubeCatalog::dimension(variant.manufacturer, TubeLine::ProximalShaftFlextend, sizeTenths)
+                    : 0;
+                const double depthCm = SATrachTube::calculateStdCathInsertDepth(proximal, distal);
+                recommendation.depthMm = qRound(depthCm * 10.0);
+            }
+
+            if (recommendation.isValid()) {
+                table.insert(key(i, sizeTenths), recommendation);
+            }
+        }
+    }
+
+    table_.swap(table);
+    emit tablesChanged();
+}
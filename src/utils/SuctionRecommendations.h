@@ -0,0 +1,48 @@
+#ifndef SUCTIONRECOMMENDATIONS_H
+#define SUCTIONRECOMMENDATIONS_H
+
+#include <QObject>
+#include <QHash>
+#include "TubeCatalog.h"
+
+struct SuctionRecommendation {
+    int catheterFr = 0;     // 0 when unknown
+    int depthMm = 0;        // 0 when the tube line has no shaft lengths
+
+    bool isValid() const { return catheterFr > 0 || depthMm > 0; }
+    QString depthText() const;
+};
+
+// Recommended suction catheter size and insertion depth for every catalog
+// tube line and size. Depths come from the shaft length tables through
+// SATrachTube::calculateStdCathInsertDepth. The table is rebuilt when the
+// catalog changes, so a lookup is a single hash probe.
+class SuctionRecommendations : public QObject
+{
+    Q_OBJECT
+
+public:
+    static SuctionRecommendations& instance();
+
+    SuctionRecommendation recommend(int variant, int sizeTenths) const;
+    SuctionRecommendation recommend(TubeManufacturer manufacturer, const QString& type, int sizeTenths) const;
+
+signals:
+    void tablesChanged();
+
+private slots:
+    void rebuild();
+
+private:
+    SuctionRecommendations();
+    SuctionRecommendations(const SuctionRecommendations&) = delete;
+    SuctionRecommendations& operator=(const SuctionRecommendations&) = delete;
+
+    static quint32 key(int variant, int sizeTenths) { return (quint32(variant) << 16) | quint32(sizeTenths); }
+
+    static SuctionRecommendations* instance_;
+
+    QHash<quint32, SuctionRecommendation> table_;
+};
+
+#endif // SUCTIONRECOMMENDATIONS_H
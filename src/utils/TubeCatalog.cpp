@@ -0,0 +1,573 @@
+#include "TubeCatalog.h"
+#include "DataFileWatcher.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace {
+
+struct DimensionEntry {
+    TubeManufacturer manufacturer;
+    TubeLine line;
+    int sizeTenths;
+    int value;
+};
+
+struct SizeEntry {
+    int sizeTenths;
+    int value;
+};
+
+constexpr bool dimensionLess(const DimensionEntry& a, const DimensionEntry& b)
+{
+    if (a.manufacturer != b.manufacturer) return a.manufacturer < b.manufacturer;
+    if (a.line != b.line) return a.line < b.line;
+    return a.sizeTenths < b.sizeTenths;
+}
+
+constexpr bool isDiameter(TubeLine line)
+{
+    return line == TubeLine::OuterDiameter || line == TubeLine::ExtendedOuterDiameter;
+}
+
+// Sorted by (manufacturer, line, size); the static_asserts below keep it that way
+constexpr DimensionEntry DIMENSIONS[] = {
+    // Bivona outer diameters (4.5 and up are pediatric only)
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 25, 40 },
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 30, 47 },
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 35, 53 },
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 40, 60 },
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 45, 67 },
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 50, 73 },
+    { TubeManufacturer::Bivona, TubeLine::OuterDiameter, 55, 80 },
+
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftNeonatal, 25, 30 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftNeonatal, 30, 32 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftNeonatal, 35, 34 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftNeonatal, 40, 36 },
+
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 25, 38 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 30, 39 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 35, 40 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 40, 41 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 45, 42 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 50, 44 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, 55, 46 },
+
+    // Flextend pediatric plus
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatricPlus, 40, 44 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatricPlus, 45, 48 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatricPlus, 50, 50 },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatricPlus, 55, 52 },
+
+    // Flextend only
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 25, 20 },
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 30, 20 },
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 35, 20 },
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 40, 20 },
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 45, 30 },
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 50, 30 },
+    { TubeManufacturer::Bivona, TubeLine::ProximalShaftFlextend, 55, 30 },
+
+    // Shiley outer diameters (5.0 and up are pediatric only)
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 25, 42 },
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 30, 48 },
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 35, 54 },
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 40, 60 },
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 45, 67 },
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 50, 73 },
+    { TubeManufacturer::Shiley, TubeLine::OuterDiameter, 55, 79 },
+
+    // TaperGuard & extra long
+    { TubeManufacturer::Shiley, TubeLine::ExtendedOuterDiameter, 60, 85 },
+    { TubeManufacturer::Shiley, TubeLine::ExtendedOuterDiameter, 65, 90 },
+
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftNeonatal, 25, 30 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftNeonatal, 30, 30 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftNeonatal, 35, 32 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftNeonatal, 40, 34 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftNeonatal, 45, 36 },
+
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 25, 39 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 30, 39 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 35, 40 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 40, 41 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 45, 42 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 50, 44 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, 55, 46 },
+
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatricExtraLong, 50, 50 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatricExtraLong, 55, 52 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatricExtraLong, 60, 54 },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatricExtraLong, 65, 56 },
+
+    // Tracoe outer diameters (verified from Atos Medical)
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 25, 44 },
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 30, 49 },
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 35, 54 },
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 40, 60 },
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 45, 67 },
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 50, 73 },
+    { TubeManufacturer::Tracoe, TubeLine::OuterDiameter, 55, 79 },
+
+    // REF 360/363
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftNeonatal, 25, 30 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftNeonatal, 30, 32 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftNeonatal, 35, 34 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftNeonatal, 40, 36 },
+
+    // REF 370/372
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 25, 38 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 30, 39 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 35, 40 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 40, 41 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 45, 42 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 50, 44 },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, 55, 46 },
+};
+
+// Standard suction catheter sizes (Fr) by trach size
+constexpr SizeEntry SUCTION_CATHETERS[] = {
+    { 25, 6 }, { 30, 6 }, { 35, 8 }, { 40, 8 }, { 45, 10 },
+    { 50, 10 }, { 55, 10 }, { 60, 12 }, { 65, 12 }
+};
+
+// ETT suction depths (cm) by ETT size
+constexpr SizeEntry ETT_SUCTION_DEPTHS[] = {
+    { 20, 14 }, { 25, 15 }, { 30, 16 }, { 35, 18 }, { 40, 20 },
+    { 45, 22 }, { 50, 24 }, { 55, 26 }, { 60, 28 }, { 65, 30 }
+};
+
+// Consistency checks, shared by the static_asserts and the file loader
+
+constexpr bool isStrictlySorted(const DimensionEntry* entries, std::size_t count)
+{
+    for (std::size_t i = 1; i < count; ++i) {
+        if (!dimensionLess(entries[i - 1], entries[i])) return false;
+    }
+    return true;
+}
+
+constexpr bool isStrictlySorted(const SizeEntry* entries, std::size_t count)
+{
+    for (std::size_t i = 1; i < count; ++i) {
+        if (entries[i - 1].sizeTenths >= entries[i].sizeTenths) return false;
+    }
+    return true;
+}
+
+// Within one manufacturer's diameter table, a larger tube is never thinner
+constexpr bool diametersGrowWithSize(const DimensionEntry* entries, std::size_t count)
+{
+    for (std::size_t i = 1; i < count; ++i) {
+        const DimensionEntry& a = entries[i - 1];
+        const DimensionEntry& b = entries[i];
+        const bool sameTable = a.manufacturer == b.manufacturer && a.line == b.line;
+        if (sameTable && isDiameter(b.line) && b.value <= a.value) return false;
+    }
+    return true;
+}
+
+// Every outer diameter is larger than the inner diameter it belongs to
+constexpr bool diametersExceedSize(const DimensionEntry* entries, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        if (isDiameter(entries[i].line) && entries[i].value <= entries[i].sizeTenths) return false;
+    }
+    return true;
+}
+
+constexpr bool valuesPositive(const DimensionEntry* entries, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        if (entries[i].sizeTenths <= 0 || entries[i].value <= 0) return false;
+    }
+    return true;
+}
+
+constexpr bool valuesPositive(const SizeEntry* entries, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        if (entries[i].sizeTenths <= 0 || entries[i].value <= 0) return false;
+    }
+    return true;
+}
+
+static_assert(isStrictlySorted(DIMENSIONS, std::size(DIMENSIONS)),
+              "DIMENSIONS must be sorted by manufacturer, line and size without duplicates");
+static_assert(isStrictlySorted(SUCTION_CATHETERS, std::size(SUCTION_CATHETERS)),
+              "SUCTION_CATHETERS must be sorted by size without duplicates");
+static_assert(isStrictlySorted(ETT_SUCTION_DEPTHS, std::size(ETT_SUCTION_DEPTHS)),
+              "ETT_SUCTION_DEPTHS must be sorted by size without duplicates");
+static_assert(diametersGrowWithSize(DIMENSIONS, std::size(DIMENSIONS)), "outer diameters must grow with tube size");
+static_assert(diametersExceedSize(DIMENSIONS, std::size(DIMENSIONS)), "outer diameters must exceed the inner diameter");
+static_assert(valuesPositive(DIMENSIONS, std::size(DIMENSIONS)), "dimensions must be positive");
+static_assert(valuesPositive(SUCTION_CATHETERS, std::size(SUCTION_CATHETERS)), "suction catheter sizes must be positive");
+static_assert(valuesPositive(ETT_SUCTION_DEPTHS, std::size(ETT_SUCTION_DEPTHS)), "ETT suction depths must be positive");
+
+int lookupSize(const SizeEntry* entries, std::size_t count, int sizeTenths)
+{
+    const SizeEntry* end = entries + count;
+    const SizeEntry* it = std::lower_bound(entries, end, sizeTenths,
+        [](const SizeEntry& entry, int size) { return entry.sizeTenths < size; });
+    return (it != end && it->sizeTenths == sizeTenths) ? it->value : 0;
+}
+
+const TubeVariant VARIANTS[] = {
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftNeonatal, false, "Bivona - Neonatal" },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, false, "Bivona - Pediatric" },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftNeonatal, true, "Bivona - Neonatal - Flextend" },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatric, true, "Bivona - Pediatric - Flextend" },
+    { TubeManufacturer::Bivona, TubeLine::DistalShaftPediatricPlus, true, "Bivona - Pediatric Plus - Flextend" },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftNeonatal, false, "Shiley - Neonatal" },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatric, false, "Shiley - Pediatric" },
+    { TubeManufacturer::Shiley, TubeLine::DistalShaftPediatricExtraLong, false, "Shiley - Pediatric - Extra Long" },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftNeonatal, false, "Tracoe - Silcosoft Neonatal" },
+    { TubeManufacturer::Tracoe, TubeLine::DistalShaftPediatric, false, "Tracoe - Silcosoft Pediatric" },
+};
+
+// Names used in tube_catalog.json; index matches the enum value
+const char* const LINE_NAMES[] = {
+    "outerDiameter",
+    "extendedOuterDiameter",
+    "distalShaftNeonatal",
+    "distalShaftPediatric",
+    "distalShaftPediatricExtraLong",
+    "distalShaftPediatricPlus",
+    "proximalShaftFlextend"
+};
+
+const char* const MANUFACTURER_NAMES[] = { "Bivona", "Shiley", "Tracoe" };
+
+bool parseSize(const QString& text, int& sizeTenths)
+{
+    bool ok = false;
+    const double size = text.toDouble(&ok);
+    sizeTenths = ok ? TubeCatalog::toTenths(size) : 0;
+    return ok && sizeTenths > 0;
+}
+
+// Inserts or replaces, keeping the table sorted
+void upsert(std::vector<DimensionEntry>& entries, const DimensionEntry& entry)
+{
+    auto it = std::lower_bound(entries.begin(), entries.end(), entry, dimensionLess);
+    if (it != entries.end() && !dimensionLess(entry, *it)) {
+        *it = entry;
+    } else {
+        entries.insert(it, entry);
+    }
+}
+
+void upsert(std::vector<SizeEntry>& entries, const SizeEntry& entry)
+{
+    auto it = std::lower_bound(entries.begin(), entries.end(), entry,
+        [](const SizeEntry& a, const SizeEntry& b) { return a.sizeTenths < b.sizeTenths; });
+    if (it != entries.end() && it->sizeTenths == entry.sizeTenths) {
+        *it = entry;
+    } else {
+        entries.insert(it, entry);
+    }
+}
+
+bool parseSizeTable(const QJsonValue& value, const QString& name, std::vector<SizeEntry>& entries,
+                    QString& errorMessage)
+{
+    if (value.isUndefined()) return true;
+    if (!value.isObject()) {
+        errorMessage = QString("\"%1\" must be an object of size: value pairs").arg(name);
+        return false;
+    }
+
+    const QJsonObject table = value.toObject();
+    for (auto it = table.begin(); it != table.end(); ++it) {
+        int sizeTenths = 0;
+        if (!parseSize(it.key(), sizeTenths) || !it.value().isDouble()) {
+            errorMessage = QString("Invalid entry \"%1\" in \"%2\"").arg(it.key(), name);
+            return false;
+        }
+        upsert(entries, { sizeTenths, it.value().toInt() });
+    }
+    return true;
+}
+
+}
+
+// A complete, sorted set of tables; never modified once published
+struct TubeCatalog::Snapshot {
+    const DimensionEntry* dimensions;
+    std::size_t dimensionCount;
+    const SizeEntry* suctionCatheters;
+    std::size_t suctionCatheterCount;
+    const SizeEntry* ettSuctionDepths;
+    std::size_t ettSuctionDepthCount;
+    int revision;
+};
+
+// A snapshot built from the catalog file, owning its tables
+struct TubeCatalog::LoadedSnapshot {
+    std::vector<DimensionEntry> dimensions;
+    std::vector<SizeEntry> suctionCatheters;
+    std::vector<SizeEntry> ettSuctionDepths;
+    Snapshot snapshot = {};
+};
+
+const TubeCatalog::Snapshot TubeCatalog::builtIn_ = {
+    DIMENSIONS, std::size(DIMENSIONS),
+    SUCTION_CATHETERS, std::size(SUCTION_CATHETERS),
+    ETT_SUCTION_DEPTHS, std::size(ETT_SUCTION_DEPTHS),
+    0
+};
+
+// Constant-initialized, so lookups work before load() and during static init
+std::atomic<const TubeCatalog::Snapshot*> TubeCatalog::current_(&TubeCatalog::builtIn_);
+
+TubeCatalog* TubeCatalog::instance_ = nullptr;
+
+TubeCatalog& TubeCatalog::instance()
+{
+    if (!instance_) {
+        instance_ = new TubeCatalog();
+    }
+    return *instance_;
+}
+
+TubeCatalog::TubeCatalog()
+    : QObject(nullptr)
+    , watcher_(nullptr)
+{
+    watcher_ = new DataFileWatcher(this);
+    connect(watcher_, &DataFileWatcher::changed, this, &TubeCatalog::reload);
+}
+
+const TubeCatalog::Snapshot* TubeCatalog::current()
+{
+    return current_.load(std::memory_order_acquire);
+}
+
+int TubeCatalog::dimension(TubeManufacturer manufacturer, TubeLine line, int sizeTenths)
+{
+    const Snapshot* snapshot = current();
+    const DimensionEntry key = { manufacturer, line, sizeTenths, 0 };
+    const DimensionEntry* end = snapshot->dimensions + snapshot->dimensionCount;
+    const DimensionEntry* it = std::lower_bound(snapshot->dimensions, end, key, dimensionLess);
+    if (it == end || dimensionLess(key, *it)) {
+        return 0;
+    }
+    return it->value;
+}
+
+int TubeCatalog::suctionCatheterFr(int trachSizeTenths)
+{
+    const Snapshot* snapshot = current();
+    return lookupSize(snapshot->suctionCatheters, snapshot->suctionCatheterCount, trachSizeTenths);
+}
+
+int TubeCatalog::ettSuctionDepthCm(int ettSizeTenths)
+{
+    const Snapshot* snapshot = current();
+    return lookupSize(snapshot->ettSuctionDepths, snapshot->ettSuctionDepthCount, ettSizeTenths);
+}
+
+QVector<int> TubeCatalog::sizes(TubeManufacturer manufacturer)
+{
+    const Snapshot* snapshot = current();
+    const DimensionEntry key = { manufacturer, TubeLine::OuterDiameter, 0, 0 };
+    const DimensionEntry* end = snapshot->dimensions + snapshot->dimensionCount;
+
+    // Both diameter lines are adjacent in the sorted table
+    QVector<int> result;
+    for (const DimensionEntry* it = std::lower_bound(snapshot->dimensions, end, key, dimensionLess);
+         it != end && it->manufacturer == manufacturer && isDiameter(it->line); ++it) {
+        result.append(it->sizeTenths);
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+int TubeCatalog::variantCount()
+{
+    return int(std::size(VARIANTS));
+}
+
+const TubeVariant& TubeCatalog::variant(int index)
+{
+    return VARIANTS[index];
+}
+
+int TubeCatalog::variantFor(TubeManufacturer manufacturer, const QString& type)
+{
+    const bool flextend = type.contains(QLatin1String("Flextend"), Qt::CaseInsensitive);
+    TubeLine line = TubeLine::DistalShaftPediatric;
+    if (type.contains(QLatin1String("Neo"), Qt::CaseInsensitive)) {
+        line = TubeLine::DistalShaftNeonatal;
+    } else if (type.contains(QLatin1String("Plus"), Qt::CaseInsensitive)) {
+        line = TubeLine::DistalShaftPediatricPlus;
+    } else if (type.contains(QLatin1String("Extra Long"), Qt::CaseInsensitive)
+               || type.contains(QLatin1String("XLT"), Qt::CaseInsensitive)) {
+        line = TubeLine::DistalShaftPediatricExtraLong;
+    }
+
+    // Exact line first, then the manufacturer's first line with the same shaft
+    int fallback = -1;
+    for (int i = 0; i < variantCount(); ++i) {
+        const TubeVariant& candidate = VARIANTS[i];
+        if (candidate.manufacturer != manufacturer || candidate.distalLine != line) continue;
+        if (candidate.flextend == flextend) return i;
+        if (fallback < 0) fallback = i;
+    }
+    return fallback;
+}
+
+int TubeCatalog::revision()
+{
+    return current()->revision;
+}
+
+void TubeCatalog::load(const QString& filePath)
+{
+    filePath_ = filePath;
+    loadedData_.clear();
+    watcher_->setFilePath(filePath_);
+    reload();
+}
+
+void TubeCatalog::reload()
+{
+    if (filePath_.isEmpty()) return;
+
+    if (!QFileInfo::exists(filePath_)) {
+        // Removing the file goes back to the built-in tables
+        if (current() != &builtIn_) {
+            loadedData_.clear();
+            publish(&builtIn_);
+        }
+        return;
+    }
+
+    QFile file(filePath_);
+    if (!file.open(QIODevice::ReadOnly)) {
+        emit error("Unable to read tube catalog: " + filePath_);
+        return;
+    }
+    const QByteArray data = file.readAll();
+    if (data == loadedData_) return;
+
+    auto loaded = std::make_unique<LoadedSnapshot>();
+    QString errorMessage;
+    if (!parse(data, *loaded, errorMessage)) {
+        // Keep serving the last good catalog
+        const QString message = QString("Tube catalog %1 was not loaded: %2")
+                                    .arg(QFileInfo(filePath_).fileName(), errorMessage);
+        qWarning("%s", qPrintable(message));
+        emit error(message);
+        return;
+    }
+
+    loadedData_ = data;
+    const Snapshot* snapshot = &loaded->snapshot;
+    snapshots_.push_back(std::move(loaded));
+    publish(snapshot);
+}
+
+void TubeCatalog::publish(const Snapshot* snapshot)
+{
+    current_.store(snapshot, std::memory_order_release);
+    emit catalogChanged();
+}
+
+bool TubeCatalog::parse(const QByteArray& data, LoadedSnapshot& loaded, QString& errorMessage)
+{
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(data, &parseError);
+    if (!doc.isObject()) {
+        errorMessage = parseError.error != QJsonParseError::NoError ? parseError.errorString()
+                                                                    : QString("expected a JSON object");
+        return false;
+    }
+
+    const QJsonObject root = doc.object();
+    const int formatVersion = root.value("formatVersion").toInt(0);
+    if (formatVersion != FormatVersion) {
+        errorMessage = QString("unsupported formatVersion %1 (expected %2)").arg(formatVersion).arg(FormatVersion);
+        return false;
+    }
+
+    // File entries are applied on top of the built-in tables
+    loaded.dimensions.assign(std::begin(DIMENSIONS), std::end(DIMENSIONS));
+    loaded.suctionCatheters.assign(std::begin(SUCTION_CATHETERS), std::end(SUCTION_CATHETERS));
+    loaded.ettSuctionDepths.assign(std::begin(ETT_SUCTION_DEPTHS), std::end(ETT_SUCTION_DEPTHS));
+
+    const QJsonArray dimensions = root.value("dimensions").toArray();
+    for (const QJsonValue& value : dimensions) {
+        const QJsonObject table = value.toObject();
+        const QString manufacturerName = table.value("manufacturer").toString();
+        const QString lineName = table.value("line").toString();
+
+        const auto manufacturerIt = std::find_if(std::begin(MANUFACTURER_NAMES), std::end(MANUFACTURER_NAMES),
+            [&manufacturerName](const char* name) { return manufacturerName == QLatin1String(name); });
+        if (manufacturerIt == std::end(MANUFACTURER_NAMES)) {
+            errorMessage = QString("unknown manufacturer \"%1\"").arg(manufacturerName);
+            return false;
+        }
+        const auto lineIt = std::find_if(std::begin(LINE_NAMES), std::end(LINE_NAMES),
+            [&lineName](const char* name) { return lineName == QLatin1String(name); });
+        if (lineIt == std::end(LINE_NAMES)) {
+            errorMessage = QString("unknown line \"%1\"").arg(lineName);
+            return false;
+        }
+
+        const TubeManufacturer manufacturer =
+            TubeManufacturer(int(TubeManufacturer::Bivona) + (manufacturerIt - std::begin(MANUFACTURER_NAMES)));
+        const TubeLine line = TubeLine(lineIt - std::begin(LINE_NAMES));
+
+        // Diameters are given in mm, shaft lengths in whole mm
+        const QJsonObject values = table.value("values").toObject();
+        for (auto it = values.begin(); it != values.end(); ++it) {
+            int sizeTenths = 0;
+            if (!parseSize(it.key(), sizeTenths) || !it.value().isDouble()) {
+                errorMessage = QString("invalid size \"%1\" in %2 %3").arg(it.key(), manufacturerName, lineName);
+                return false;
+            }
+            const double number = it.value().toDouble();
+            const int stored = isDiameter(line) ? toTenths(number) : qRound(number);
+            upsert(loaded.dimensions, { manufacturer, line, sizeTenths, stored });
+        }
+    }
+
+    if (!parseSizeTable(root.value("suctionCatheters"), "suctionCatheters", loaded.suctionCatheters, errorMessage)
+        || !parseSizeTable(root.value("ettSuctionDepths"), "ettSuctionDepths", loaded.ettSuctionDepths, errorMessage)) {
+        return false;
+    }
+
+    // Same rules the built-in tables are held to at compile time
+    const DimensionEntry* dims = loaded.dimensions.data();
+    const std::size_t dimCount = loaded.dimensions.size();
+    if (!valuesPositive(dims, dimCount)
+        || !valuesPositive(loaded.suctionCatheters.data(), loaded.suctionCatheters.size())
+        || !valuesPositive(loaded.ettSuctionDepths.data(), loaded.ettSuctionDepths.size())) {
+        errorMessage = "sizes and values must be positive";
+        return false;
+    }
+    if (!diametersExceedSize(dims, dimCount)) {
+        errorMessage = "an outer diameter is not larger than its tube size";
+        return false;
+    }
+    if (!diametersGrowWithSize(dims, dimCount)) {
+        errorMessage = "outer diameters must grow with tube size";
+        return false;
+    }
+
+    loaded.snapshot = {
+        loaded.dimensions.data(), loaded.dimensions.size(),
+        loaded.suctionCatheters.data(), loaded.suctionCatheters.size(),
+        loaded.ettSuctionDepths.data(), loaded.ettSuctionDepths.size(),
+        root.value("revision").toInt(1)
+    };
+    return true;
+}
@@ -0,0 +1,103 @@
+#ifndef TUBECATALOG_H
+#define TUBECATALOG_H
+
+#include <QObject>
+#include <QVector>
+#include <QByteArray>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "models/TubeVocabulary.h"
+
+class DataFileWatcher;
+
+// Which dimension table a catalog entry belongs to
+enum class TubeLine : quint8 {
+    OuterDiameter = 0,          // standard outer diameter, tenths of a mm
+    ExtendedOuterDiameter,      // Shiley TaperGuard / extra long sizes, tenths of a mm
+    DistalShaftNeonatal,        // mm
+    DistalShaftPediatric,       // mm
+    DistalShaftPediatricExtraLong,
+    DistalShaftPediatricPlus,
+    ProximalShaftFlextend       // mm
+};
+
+// A tube line: one manufacturer's tubes sharing a shaft length table.
+// Names follow the SATrachTube type lists.
+struct TubeVariant {
+    TubeManufacturer manufacturer;
+    TubeLine distalLine;
+    bool flextend;              // has a proximal shaft
+    const char* name;
+};
+
+// Standard tube dimensions. The built-in tables are compiled in; a versioned
+// tube_catalog.json next to the case saves can add or correct entries without
+// a rebuild. Each load builds a complete sorted snapshot which is published
+// with a single atomic pointer swap, so lookups never lock or wait and are
+// safe from any thread. Sizes are in tenths of a millimetre (3.5 mm -> 35).
+class TubeCatalog : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int FormatVersion = 1;
+
+    static TubeCatalog& instance();
+
+    // 0 when the catalog has no entry
+    static int dimension(TubeManufacturer manufacturer, TubeLine line, int sizeTenths);
+    static int suctionCatheterFr(int trachSizeTenths);
+    static int ettSuctionDepthCm(int ettSizeTenths);
+
+    // Sizes with an outer diameter for the manufacturer, ascending
+    static QVector<int> sizes(TubeManufacturer manufacturer);
+
+    // Tube lines the shaft tables describe
+    static int variantCount();
+    static const TubeVariant& variant(int index);
+    // Tube line for a manufacturer and the free-text type, or -1
+    static int variantFor(TubeManufacturer manufacturer, const QString& type);
+
+    // Revision from the loaded file, 0 for the built-in tables
+    static int revision();
+
+    static int toTenths(double size) { return qRound(size * 10.0); }
+
+    // Loads the catalog file, if present, and reloads it whenever it changes
+    void load(const QString& filePath);
+    QString filePath() const { return filePath_; }
+
+signals:
+    void catalogChanged();
+    void error(const QString& message);
+
+private slots:
+    void reload();
+
+private:
+    struct Snapshot;
+    struct LoadedSnapshot;
+
+    TubeCatalog();
+    TubeCatalog(const TubeCatalog&) = delete;
+    TubeCatalog& operator=(const TubeCatalog&) = delete;
+
+    static const Snapshot* current();
+    static bool parse(const QByteArray& data, LoadedSnapshot& loaded, QString& errorMessage);
+    void publish(const Snapshot* snapshot);
+
+    static TubeCatalog* instance_;
+    static const Snapshot builtIn_;
+    static std::atomic<const Snapshot*> current_;
+
+    QString filePath_;
+    QByteArray loadedData_;
+    DataFileWatcher* watcher_;
+
+    // Readers may still hold a replaced snapshot, so they are kept for the
+    // life of the process; reloads are rare and a snapshot is a few KB
+    std::vector<std::unique_ptr<LoadedSnapshot>> snapshots_;
+};
+
+#endif // TUBECATALOG_H
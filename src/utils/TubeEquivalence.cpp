@@ -0,0 +1,125 @@
+#include "TubeEquivalence.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+// A tenth of a millimetre of outer diameter counts as much as two
+// millimetres of shaft length: the stoma has to take the tube first
+const int OUTER_DIAMETER_WEIGHT = 2;
+
+struct TubeDimensions {
+    int sizeTenths;
+    int outerDiameterTenths;
+    int distalShaftMm;
+    int proximalShaftMm;
+};
+
+int outerDiameter(TubeManufacturer manufacturer, int sizeTenths)
+{
+    const int standard = TubeCatalog::dimension(manufacturer, TubeLine::OuterDiameter, sizeTenths);
+    return standard > 0 ? standard
+                        : TubeCatalog::dimension(manufacturer, TubeLine::ExtendedOuterDiameter, sizeTenths);
+}
+
+// Sizes of a variant with both an outer diameter and a shaft length
+QVector<TubeDimensions> variantDimensions(const TubeVariant& variant)
+{
+    QVector<TubeDimensions> result;
+    const QVector<int> sizes = TubeCatalog::sizes(variant.manufacturer);
+    for (int sizeTenths : sizes) {
+        const int distal = TubeCatalog::dimension(variant.manufacturer, variant.distalLine, sizeTenths);
+        if (distal == 0) continue;
+
+        const int proximal = variant.flextend
+            ? TubeCatalog::dimension(variant.manufacturer, TubeLine::ProximalShaftFlextend, sizeTenths)
+            : 0;
+        result.append({ sizeTenths, outerDiameter(variant.manufacturer, sizeTenths), distal, proximal });
+    }
+    return result;
+}
+
+int score(const TubeDimensions& a, const TubeDimensions& b)
+{
+    return OUTER_DIAMETER_WEIGHT * std::abs(a.outerDiameterTenths - b.outerDiameterTenths)
+           + std::abs(a.distalShaftMm - b.distalShaftMm)
+           + std::abs(a.proximalShaftMm - b.proximalShaftMm);
+}
+
+}
+
+TubeEquivalence* TubeEquivalence::instance_ = nullptr;
+
+TubeEquivalence& TubeEquivalence::instance()
+{
+    if (!instance_) {
+        instance_ = new TubeEquivalence();
+    }
+    return *instance_;
+}
+
+TubeEquivalence::TubeEquivalence()
+    : QObject(nullptr)
+{
+    connect(&TubeCatalog::instance(), &TubeCatalog::catalogChanged, this, &TubeEquivalence::rebuild);
+    rebuild();
+}
+
+QString TubeEquivalence::variantName(int variant)
+{
+    if (variant < 0 || variant >= TubeCatalog::variantCount()) return QString();
+    return QString::fromLatin1(TubeCatalog::variant(variant).name);
+}
+
+const QVector<TubeEquivalence::Match>& TubeEquivalence::matches(int variant, int sizeTenths) const
+{
+    static const QVector<Match> none;
+    auto it = table_.constFind(key(variant, sizeTenths));
+    return it != table_.constEnd() ? it.value() : none;
+}
+
+void TubeEquivalence::rebuild()
+{
+    const int variantCount = TubeCatalog::variantCount();
+    QVector<QVector<TubeDimensions>> dimensions;
+    dimensions.reserve(variantCount);
+    for (int i = 0; i < variantCount; ++i) {
+        dimensions.append(variantDimensions(TubeCatalog::variant(i)));
+    }
+
+    QHash<quint32, QVector<Match>> table;
+    for (int source = 0; source < variantCount; ++source) {
+        for (const TubeDimensions& tube : dimensions[source]) {
+            QVector<Match> ranked;
+
+            // Best size from each line of the other manufacturers
+            for (int candidate = 0; candidate < variantCount; ++candidate) {
+                if (TubeCatalog::variant(candidate).manufacturer == TubeCatalog::variant(source).manufacturer) continue;
+
+                const TubeDimensions* best = nullptr;
+                int bestScore = 0;
+                for (const TubeDimensions& other : dimensions[candidate]) {
+                    const int otherScore = score(tube, other);
+                    if (!best || otherScore < bestScore) {
+                        best = &other;
+                        bestScore = otherScore;
+                    }
+                }
+                if (best) {
+                    ranked.append({ candidate, best->sizeTenths, best->outerDiameterTenths,
+                                    best->distalShaftMm, best->proximalShaftMm, bestScore });
+                }
+            }
+
+            std::stable_sort(ranked.begin(), ranked.end(),
+                             [](const Match& a, const Match& b) { return a.score < b.score; });
+            if (ranked.size() > MaxMatches) {
+                ranked.resize(MaxMatches);
+            }
+            table.insert(key(source, tube.sizeTenths), ranked);
+        }
+    }
+
+    table_.swap(table);
+    emit tablesChanged();
+}
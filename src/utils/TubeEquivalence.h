@@ -0,0 +1,55 @@
+#ifndef TUBEEQUIVALENCE_H
+#define TUBEEQUIVALENCE_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include "TubeCatalog.h"
+
+// Finds the closest tube from the other manufacturers when the one in use is
+// not available. Every (tube line, size) in the catalog is ranked against
+// every line of the other manufacturers by outer diameter and distal and
+// proximal shaft length. The rankings are precomputed whenever the catalog
+// changes, so a lookup is a single hash probe.
+class TubeEquivalence : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Match {
+        int variant;
+        int sizeTenths;
+        int outerDiameterTenths;
+        int distalShaftMm;
+        int proximalShaftMm;
+        int score;              // lower is closer
+    };
+
+    static const int MaxMatches = 4;
+
+    static TubeEquivalence& instance();
+
+    static QString variantName(int variant);
+
+    // Closest first; empty when the tube is not in the catalog
+    const QVector<Match>& matches(int variant, int sizeTenths) const;
+
+signals:
+    void tablesChanged();
+
+private slots:
+    void rebuild();
+
+private:
+    TubeEquivalence();
+    TubeEquivalence(const TubeEquivalence&) = delete;
+    TubeEquivalence& operator=(const TubeEquivalence&) = delete;
+
+    static quint32 key(int variant, int sizeTenths) { return (quint32(variant) << 16) | quint32(sizeTenths); }
+
+    static TubeEquivalence* instance_;
+
+    QHash<quint32, QVector<Match>> table_;
+};
+
+#endif // TUBEEQUIVALENCE_H
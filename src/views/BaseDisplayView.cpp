@@ -1,4 +1,8 @@
 #include "BaseDisplayView.h"
+#include "TracheostomyDisplayView.h"
+#include "NewTracheostomyDisplayView.h"
+#include "DifficultAirwayDisplayView.h"
+#include "LTRDisplayView.h"
 #include "utils/StyleManager.h"
 #include <QGuiApplication>
 #include <QScreen>
@@ -46,6 +50,7 @@ void BaseDisplayView::setupUI()
     // Set background color based on case type
     setStyleSheet(QString("QWidget#BaseDisplayView { background-color: %1; }").arg(caseColor));
     setObjectName("BaseDisplayView");
+    setAttribute(Qt::WA_StyledBackground);
 
     // Header section with logo and title
     headerLayout_ = new QHBoxLayout();
@@ -84,7 +89,6 @@ void BaseDisplayView::setupUI()
     // Case-specific content area
     specificContentWidget_ = new QWidget();
     specificContentLayout_ = new QVBoxLayout(specificContentWidget_);
-    setupCaseSpecificFields();
 
     contentLayout_->addWidget(patientGroup_);
     contentLayout_->addWidget(trachGroup_);
@@ -109,6 +113,42 @@ void BaseDisplayView::setupUI()
     connect(closeDisplayButton_, &QPushButton::clicked, this, &BaseDisplayView::onCloseDisplayClicked);
 }
 
+void BaseDisplayView::finishSetup()
+{
+    // Virtual calls are not dispatched to subclasses from the base constructor
+    setupCaseSpecificFields();
+}
+
+BaseDisplayView* BaseDisplayView::create(CaseType caseType, QWidget* parent)
+{
+    BaseDisplayView* view = nullptr;
+    switch (caseType) {
+    case CaseType::Tracheostomy:
+        view = new TracheostomyDisplayView(parent);
+        break;
+    case CaseType::NewTracheostomy:
+        view = new NewTracheostomyDisplayView(parent);
+        break;
+    case CaseType::DifficultAirway:
+        view = new DifficultAirwayDisplayView(parent);
+        break;
+    case CaseType::LTR:
+        view = new LTRDisplayView(parent);
+        break;
+    }
+
+    if (view) {
+        view->finishSetup();
+    }
+    return view;
+}
+
+void BaseDisplayView::setControlsVisible(bool visible)
+{
+    backToFormButton_->setVisible(visible);
+    closeDisplayButton_->setVisible(visible);
+}
+
 void BaseDisplayView::setupPatientInfo()
 {
     patientGroup_ = new QGroupBox("Patient Information");
@@ -184,15 +224,11 @@ void BaseDisplayView::updateDisplay()
     QList<SpecificationTableRow> specs = currentCase_.getSpecTable();
     if (!specs.isEmpty()) {
         SpecificationTableRow spec = specs.first();
-        QString trachDetail = QString("%1 %2 %3")
-                              .arg(spec.type)
-                              .arg(spec.size)
-                              .arg(spec.cuff);
-        trachDetailLabel_->setText(trachDetail);
+        trachDetailLabel_->setText(formatTrachDetail(spec));
 
         // Update ETT size recommendations in emergency procedures
-        intubateAboveLabel_->setText(QString("2. Intubate from Above with %1 ETT").arg(spec.size));
-        intubateStomaLabel_->setText(QString("3. Intubate through Stoma with %1 ETT").arg(spec.size));
+        intubateAboveLabel_->setText(formatIntubateAbove(spec.size()));
+        intubateStomaLabel_->setText(formatIntubateStoma(spec.size()));
     }
 
     // Update decision box status
@@ -203,9 +239,39 @@ void BaseDisplayView::updateDisplay()
     intubateStomaLabel_->setVisible(decision.intubateStoma);
 }
 
+QString BaseDisplayView::formatTrachDetail(const SpecificationTableRow& spec)
+{
+    return QString("%1 %2 %3")
+           .arg(spec.type())
+           .arg(spec.size())
+           .arg(spec.cuff());
+}
+
+QString BaseDisplayView::formatIntubateAbove(const QString& ettSize)
+{
+    return QString("2. Intubate from Above with %1 ETT").arg(ettSize);
+}
+
+QString BaseDisplayView::formatIntubateStoma(const QString& ettSize)
+{
+    return QString("3. Intubate through Stoma with %1 ETT").arg(ettSize);
+}
+
+QString BaseDisplayView::formatSuctionInfo(const SuctionInfo& suction)
+{
+    return QString("Suction Catheter: %1 Fr\nSuction Depth: %2 cm")
+           .arg(suction.size)
+           .arg(suction.depth);
+}
+
 QString BaseDisplayView::getCaseTypeColor() const
 {
-    switch (caseType_) {
+    return getCaseTypeColor(caseType_);
+}
+
+QString BaseDisplayView::getCaseTypeColor(CaseType caseType)
+{
+    switch (caseType) {
         case CaseType::Tracheostomy:
             return "#e8e8e8";
         case CaseType::NewTracheostomy:
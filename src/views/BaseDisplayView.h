@@ -19,9 +19,26 @@ public:
     explicit BaseDisplayView(CaseType caseType, QWidget* parent = nullptr);
     virtual ~BaseDisplayView() = default;
 
+    // Must be called after construction to build the case-specific fields
+    void finishSetup();
+
+    // Builds the display view matching a case type, fully set up
+    static BaseDisplayView* create(CaseType caseType, QWidget* parent = nullptr);
+
     virtual void setCase(const Case& case_);
     Case getCase() const { return currentCase_; }
 
+    // Kiosk rendering hides the on-screen controls
+    void setControlsVisible(bool visible);
+
+    // Card text shared with DisplayCardRenderer; these only touch strings and
+    // are safe to call from worker threads
+    static QString formatTrachDetail(const SpecificationTableRow& spec);
+    static QString formatIntubateAbove(const QString& ettSize);
+    static QString formatIntubateStoma(const QString& ettSize);
+    static QString formatSuctionInfo(const SuctionInfo& suction);
+    static QString getCaseTypeColor(CaseType caseType);
+
 signals:
     void backToFormRequested();
     void closeDisplayRequested();
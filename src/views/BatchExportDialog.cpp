@@ -0,0 +1,252 @@
+#include "BatchExportDialog.h"
+#include "core/CaseManager.h"
+#include "utils/ConfigManager.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QPrinter>
+#include <QPrintDialog>
+#include <QPageLayout>
+
+BatchExportDialog::BatchExportDialog(CaseManager* caseManager, QWidget* parent)
+    : QDialog(parent)
+    , caseManager_(caseManager)
+    , exporter_(nullptr)
+    , selectionCombo_(nullptr)
+    , countLabel_(nullptr)
+    , statusLabel_(nullptr)
+    , progressBar_(nullptr)
+    , exportPdfButton_(nullptr)
+    , printButton_(nullptr)
+    , closeButton_(nullptr)
+{
+    exporter_ = new BatchExporter(this);
+
+    setupUI();
+    connectSignals();
+    onSelectionChanged();
+}
+
+void BatchExportDialog::setupUI()
+{
+    setWindowTitle("Print Case Cards");
+    setMinimumWidth(700);
+    setStyleSheet(
+        "QDialog { background-color: white; }"
+        "QLabel { font-size: 22px; color: #2C3E50; }"
+        "QComboBox { font-size: 22px; padding: 8px; border: 1px solid #B0BEC5; border-radius: 6px; }"
+        "QProgressBar { font-size: 18px; border: 1px solid #B0BEC5; border-radius: 6px; height: 28px; text-align: center; }"
+        "QProgressBar::chunk { background-color: #1976D2; border-radius: 6px; }"
+    );
+
+    QVBoxLayout* layout = new QVBoxLayout(this);
+    layout->setSpacing(15);
+    layout->setContentsMargins(30, 25, 30, 25);
+
+    QLabel* titleLabel = new QLabel("Print or export a card for each selected case");
+    titleLabel->setStyleSheet("font-size: 26px; font-weight: bold;");
+    layout->addWidget(titleLabel);
+
+    selectionCombo_ = new QComboBox();
+    selectionCombo_->addItem("All cases", AllCases);
+    selectionCombo_->addItem("Tracheostomy", TracheostomyCases);
+    selectionCombo_->addItem("New Tracheostomy", NewTracheostomyCases);
+    selectionCombo_->addItem("Difficult Airway", DifficultAirwayCases);
+    selectionCombo_->addItem("LTR", LTRCases);
+    selectionCombo_->addItem("Updated today", UpdatedToday);
+    layout->addWidget(selectionCombo_);
+
+    countLabel_ = new QLabel();
+    layout->addWidget(countLabel_);
+
+    progressBar_ = new QProgressBar();
+    progressBar_->setRange(0, 1);
+    progressBar_->setValue(0);
+    layout->addWidget(progressBar_);
+
+    statusLabel_ = new QLabel();
+    statusLabel_->setStyleSheet("font-size: 18px; color: #546E7A;");
+    statusLabel_->setWordWrap(true);
+    layout->addWidget(statusLabel_);
+
+    auto createButton = [](const QString& text, const QString& color, const QString& hoverColor) -> QPushButton* {
+        QPushButton* button = new QPushButton(text);
+        button->setMinimumHeight(55);
+        button->setCursor(Qt::PointingHandCursor);
+        button->setStyleSheet(QString(
+            "QPushButton {"
+            "   background-color: %1;"
+            "   color: white;"
+            "   font-weight: bold;"
+            "   font-size: 22px;"
+            "   border: none;"
+            "   border-radius: 8px;"
+            "   padding: 10px 20px;"
+            "}"
+            "QPushButton:hover {"
+            "   background-color: %2;"
+            "}"
+            "QPushButton:disabled {"
+            "   background-color: #B0BEC5;"
+            "}"
+        ).arg(color, hoverColor));
+        return button;
+    };
+
+    exportPdfButton_ = createButton("Export PDF...", "#1976D2", "#1565C0");
+    printButton_ = createButton("Print...", "#78909C", "#607D8B");
+    closeButton_ = createButton("Close", "#DC143C", "#B22222");
+
+    QHBoxLayout* buttonLayout = new QHBoxLayout();
+    buttonLayout->addWidget(exportPdfButton_);
+    buttonLayout->addWidget(printButton_);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(closeButton_);
+    layout->addLayout(buttonLayout);
+}
+
+void BatchExportDialog::connectSignals()
+{
+    connect(selectionCombo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &BatchExportDialog::onSelectionChanged);
+    connect(exportPdfButton_, &QPushButton::clicked, this, &BatchExportDialog::onExportPdfClicked);
+    connect(printButton_, &QPushButton::clicked, this, &BatchExportDialog::onPrintClicked);
+    connect(closeButton_, &QPushButton::clicked, this, &BatchExportDialog::reject);
+
+    connect(exporter_, &BatchExporter::progress, this, &BatchExportDialog::onProgress);
+    connect(exporter_, &BatchExporter::finished, this, &BatchExportDialog::onFinished);
+    connect(exporter_, &BatchExporter::error, this, [this](const QString& message) {
+        statusLabel_->setText(message);
+    });
+}
+
+QStringList BatchExportDialog::selectedFiles() const
+{
+    switch (selectionCombo_->currentData().toInt()) {
+    case TracheostomyCases:
+        return caseManager_->getCasesByType(CaseType::Tracheostomy);
+    case NewTracheostomyCases:
+        return caseManager_->getCasesByType(CaseType::NewTracheostomy);
+    case DifficultAirwayCases:
+        return caseManager_->getCasesByType(CaseType::DifficultAirway);
+    case LTRCases:
+        return caseManager_->getCasesByType(CaseType::LTR);
+    default:
+        return caseManager_->getAllCases();
+    }
+}
+
+BatchExporter::CaseFilter BatchExportDialog::selectedFilter() const
+{
+    if (selectionCombo_->currentData().toInt() == UpdatedToday) {
+        return BatchExporter::updatedToday();
+    }
+    return BatchExporter::CaseFilter();
+}
+
+void BatchExportDialog::onSelectionChanged()
+{
+    int count = selectedFiles().size();
+    if (selectionCombo_->currentData().toInt() == UpdatedToday) {
+        countLabel_->setText(QString("%1 saved cases will be checked").arg(count));
+    } else {
+        countLabel_->setText(QString("%1 cases selected").arg(count));
+    }
+    statusLabel_->clear();
+    progressBar_->setRange(0, 1);
+    progressBar_->setValue(0);
+}
+
+void BatchExportDialog::onExportPdfClicked()
+{
+    QString defaultDir = ConfigManager::instance().getLastDirectory();
+    if (defaultDir.isEmpty()) {
+        defaultDir = caseManager_->getBasePath();
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(this,
+        "Export Case Cards",
+        defaultDir + "/safe-airway-cards.pdf",
+        "PDF files (*.pdf)");
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+    if (!fileName.endsWith(".pdf", Qt::CaseInsensitive)) {
+        fileName += ".pdf";
+    }
+
+    ConfigManager::instance().saveLastDirectory(QFileInfo(fileName).absolutePath());
+
+    if (exporter_->exportPdf(selectedFiles(), selectedFilter(), fileName)) {
+        statusLabel_->setText("Exporting to " + fileName);
+        setRunning(true);
+    }
+}
+
+void BatchExportDialog::onPrintClicked()
+{
+    QPrinter* printer = new QPrinter(QPrinter::HighResolution);
+    printer->setPageOrientation(QPageLayout::Landscape);
+    printer->setPageMargins(QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter);
+
+    QPrintDialog printDialog(printer, this);
+    printDialog.setWindowTitle("Print Case Cards");
+    if (printDialog.exec() != QDialog::Accepted) {
+        delete printer;
+        return;
+    }
+
+    // The exporter takes ownership of the printer
+    if (exporter_->print(selectedFiles(), selectedFilter(), printer)) {
+        statusLabel_->setText("Sending cards to the printer");
+        setRunning(true);
+    }
+}
+
+void BatchExportDialog::onProgress(int processed, int total)
+{
+    progressBar_->setRange(0, qMax(1, total));
+    progressBar_->setValue(processed);
+}
+
+void BatchExportDialog::onFinished(int pagesWritten, int failedFiles, bool cancelled)
+{
+    setRunning(false);
+
+    QString status;
+    if (cancelled) {
+        status = QString("Stopped after %1 cards").arg(pagesWritten);
+    } else if (pagesWritten == 0) {
+        status = "No cases matched the selection";
+    } else {
+        status = QString("Finished: %1 cards").arg(pagesWritten);
+    }
+    if (failedFiles > 0) {
+        status += QString(" (%1 files could not be read)").arg(failedFiles);
+    }
+    statusLabel_->setText(status);
+}
+
+void BatchExportDialog::setRunning(bool running)
+{
+    selectionCombo_->setEnabled(!running);
+    exportPdfButton_->setEnabled(!running);
+    printButton_->setEnabled(!running);
+    closeButton_->setText(running ? "Cancel" : "Close");
+    if (running) {
+        progressBar_->setRange(0, 0);
+    }
+}
+
+void BatchExportDialog::reject()
+{
+    // First press stops a running job, the next one closes
+    if (exporter_->isRunning()) {
+        exporter_->cancel();
+        statusLabel_->setText("Cancelling...");
+        return;
+    }
+    QDialog::reject();
+}
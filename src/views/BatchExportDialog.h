@@ -0,0 +1,60 @@
+#ifndef BATCHEXPORTDIALOG_H
+#define BATCHEXPORTDIALOG_H
+
+#include <QDialog>
+#include <QComboBox>
+#include <QLabel>
+#include <QProgressBar>
+#include <QPushButton>
+#include "core/BatchExporter.h"
+
+class CaseManager;
+
+// Picks a selection of saved cases and prints or exports them as one PDF
+class BatchExportDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit BatchExportDialog(CaseManager* caseManager, QWidget* parent = nullptr);
+
+public slots:
+    void reject() override;
+
+private slots:
+    void onSelectionChanged();
+    void onExportPdfClicked();
+    void onPrintClicked();
+    void onProgress(int processed, int total);
+    void onFinished(int pagesWritten, int failedFiles, bool cancelled);
+
+private:
+    enum Selection {
+        AllCases = 0,
+        TracheostomyCases,
+        NewTracheostomyCases,
+        DifficultAirwayCases,
+        LTRCases,
+        UpdatedToday
+    };
+
+    CaseManager* caseManager_;
+    BatchExporter* exporter_;
+
+    QComboBox* selectionCombo_;
+    QLabel* countLabel_;
+    QLabel* statusLabel_;
+    QProgressBar* progressBar_;
+    QPushButton* exportPdfButton_;
+    QPushButton* printButton_;
+    QPushButton* closeButton_;
+
+    void setupUI();
+    void connectSignals();
+    void setRunning(bool running);
+
+    QStringList selectedFiles() const;
+    BatchExporter::CaseFilter selectedFilter() const;
+};
+
+#endif // BATCHEXPORTDIALOG_H
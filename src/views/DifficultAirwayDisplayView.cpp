@@ -0,0 +1,49 @@
+#include "DifficultAirwayDisplayView.h"
+#include <QGroupBox>
+
+DifficultAirwayDisplayView::DifficultAirwayDisplayView(QWidget* parent)
+    : BaseDisplayView(CaseType::DifficultAirway, parent)
+    , diagnosisLabel_(nullptr)
+    , suctionInfoLabel_(nullptr)
+{
+}
+
+void DifficultAirwayDisplayView::setupCaseSpecificFields()
+{
+    // Airway diagnosis
+    QGroupBox* diagnosisGroup = new QGroupBox("Airway Diagnosis");
+    QVBoxLayout* diagnosisLayout = new QVBoxLayout(diagnosisGroup);
+
+    diagnosisLabel_ = new QLabel();
+    diagnosisLabel_->setAlignment(Qt::AlignCenter);
+    diagnosisLabel_->setStyleSheet("font-size: 32px; font-weight: bold; color: #333; padding: 15px;");
+    diagnosisLabel_->setWordWrap(true);
+
+    diagnosisLayout->addWidget(diagnosisLabel_);
+
+    // Suction information
+    QGroupBox* suctionGroup = new QGroupBox("Suction Information");
+    QVBoxLayout* suctionLayout = new QVBoxLayout(suctionGroup);
+
+    suctionInfoLabel_ = new QLabel();
+    suctionInfoLabel_->setAlignment(Qt::AlignCenter);
+    suctionInfoLabel_->setStyleSheet("font-size: 28px; font-weight: bold; color: #0066CC; padding: 15px;");
+    suctionInfoLabel_->setWordWrap(true);
+
+    suctionLayout->addWidget(suctionInfoLabel_);
+
+    specificContentLayout_->addWidget(diagnosisGroup);
+    specificContentLayout_->addWidget(suctionGroup);
+    specificContentLayout_->addStretch();
+}
+
+void DifficultAirwayDisplayView::updateDisplay()
+{
+    // Call base class implementation first
+    BaseDisplayView::updateDisplay();
+
+    // Update difficult airway-specific fields
+    diagnosisLabel_->setText(currentCase_.getAirwayDiagnosis());
+
+    suctionInfoLabel_->setText(formatSuctionInfo(currentCase_.getSuction()));
+}
\ No newline at end of file
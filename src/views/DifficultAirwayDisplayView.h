@@ -0,0 +1,23 @@
+#ifndef DIFFICULTAIRWAYDISPLAYVIEW_H
+#define DIFFICULTAIRWAYDISPLAYVIEW_H
+
+#include "BaseDisplayView.h"
+#include <QLabel>
+
+class DifficultAirwayDisplayView : public BaseDisplayView
+{
+    Q_OBJECT
+
+public:
+    explicit DifficultAirwayDisplayView(QWidget* parent = nullptr);
+
+protected:
+    void setupCaseSpecificFields() override;
+    void updateDisplay() override;
+
+private:
+    QLabel* diagnosisLabel_;
+    QLabel* suctionInfoLabel_;
+};
+
+#endif // DIFFICULTAIRWAYDISPLAYVIEW_H
\ No newline at end of file
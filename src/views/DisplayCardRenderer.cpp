@@ -0,0 +1,157 @@
+#include "DisplayCardRenderer.h"
+#include "BaseDisplayView.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <QGuiApplication>
+
+namespace {
+
+const qreal CARD_WIDTH = 800.0;
+const qreal CARD_HEIGHT = 600.0;
+const qreal PADDING = 20.0;
+const qreal CORNER_RADIUS = 16.0;
+
+QFont makeFont(int pixelSize, bool bold)
+{
+    QFont font = QGuiApplication::font();
+    font.setPixelSize(pixelSize);
+    font.setBold(bold);
+    return font;
+}
+
+QStringList emergencySteps(const Case& displayCase)
+{
+    QString ettSize;
+    const QList<SpecificationTableRow> specs = displayCase.getSpecTable();
+    if (!specs.isEmpty()) {
+        ettSize = specs.first().size();
+    }
+
+    // Same wording and visibility rules as the display view
+    const DecisionBox decision = displayCase.getDecisionBox();
+    QStringList steps;
+    if (decision.maskVentilate) {
+        steps << "1. Mask Ventilate";
+    }
+    if (decision.intubateAbove) {
+        steps << (ettSize.isEmpty() ? QString("2. Intubate from Above")
+                                    : BaseDisplayView::formatIntubateAbove(ettSize));
+    }
+    if (decision.intubateStoma) {
+        steps << (ettSize.isEmpty() ? QString("3. Intubate through Stoma")
+                                    : BaseDisplayView::formatIntubateStoma(ettSize));
+    }
+    return steps;
+}
+
+QString caseDetails(const Case& displayCase)
+{
+    switch (displayCase.getCaseType()) {
+    case CaseType::Tracheostomy:
+        return displayCase.getTrachIndication();
+    case CaseType::NewTracheostomy:
+        return QString("%1\nExtubation Date: %2")
+               .arg(displayCase.getProcedure(), displayCase.getExtubationDate());
+    case CaseType::DifficultAirway:
+        return displayCase.getAirwayDiagnosis();
+    case CaseType::LTR:
+        return QString("%1\nExtubation Date: %2")
+               .arg(displayCase.getProcedure(), displayCase.getExtubationDate());
+    }
+    return QString();
+}
+
+} // namespace
+
+QSizeF DisplayCardRenderer::cardSize()
+{
+    return QSizeF(CARD_WIDTH, CARD_HEIGHT);
+}
+
+QImage DisplayCardRenderer::render(const Case& displayCase, const QSize& size, qreal devicePixelRatio)
+{
+    QImage image(size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    paint(&painter, displayCase, QRectF(QPointF(0, 0), QSizeF(size)));
+    painter.end();
+
+    return image;
+}
+
+void DisplayCardRenderer::paint(QPainter* painter, const Case& displayCase, const QRectF& targetRect)
+{
+    if (!painter || targetRect.isEmpty()) return;
+
+    // Uniform scale, centred in the target
+    const qreal scale = qMin(targetRect.width() / CARD_WIDTH, targetRect.height() / CARD_HEIGHT);
+    const QPointF origin(targetRect.center().x() - CARD_WIDTH * scale / 2.0,
+                         targetRect.center().y() - CARD_HEIGHT * scale / 2.0);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setRenderHint(QPainter::TextAntialiasing);
+    painter->translate(origin);
+    painter->scale(scale, scale);
+
+    const qreal contentWidth = CARD_WIDTH - 2 * PADDING;
+
+    // Card background in the case colour
+    QPainterPath background;
+    background.addRoundedRect(QRectF(0, 0, CARD_WIDTH, CARD_HEIGHT), CORNER_RADIUS, CORNER_RADIUS);
+    painter->fillPath(background, QColor(BaseDisplayView::getCaseTypeColor(displayCase.getCaseType())));
+
+    // Patient first name only, as on the display view
+    painter->setPen(QColor("#333333"));
+    painter->setFont(makeFont(64, true));
+    painter->drawText(QRectF(PADDING, 10, contentWidth, 84), Qt::AlignCenter | Qt::TextSingleLine,
+                      displayCase.getPatient().firstName);
+
+    const QList<SpecificationTableRow> specs = displayCase.getSpecTable();
+    painter->setPen(Qt::black);
+    painter->setFont(makeFont(36, true));
+    painter->drawText(QRectF(PADDING, 96, contentWidth, 56), Qt::AlignCenter | Qt::TextWordWrap,
+                      specs.isEmpty() ? QString() : BaseDisplayView::formatTrachDetail(specs.first()));
+
+    // Emergency procedures box
+    const QRectF emergencyRect(PADDING, 160, contentWidth, 250);
+    painter->setPen(QPen(QColor("#FF0000"), 3));
+    painter->setBrush(QColor("#FFEEEE"));
+    painter->drawRoundedRect(emergencyRect, 8, 8);
+    painter->setBrush(Qt::NoBrush);
+
+    painter->setFont(makeFont(30, true));
+    qreal stepY = emergencyRect.top() + 12;
+    for (const QString& step : emergencySteps(displayCase)) {
+        painter->drawText(QRectF(emergencyRect.left() + 16, stepY, emergencyRect.width() - 32, 44),
+                          Qt::AlignLeft | Qt::AlignVCenter | Qt::TextSingleLine, step);
+        stepY += 48;
+    }
+
+    const QRectF contactRect(emergencyRect.left() + 16, emergencyRect.bottom() - 66, emergencyRect.width() - 32, 52);
+    painter->fillRect(contactRect, QColor("#FFFF00"));
+    painter->setPen(QPen(QColor("#FF0000"), 2));
+    painter->drawRect(contactRect);
+    painter->setFont(makeFont(26, true));
+    painter->drawText(contactRect, Qt::AlignCenter, "In Case of Emergency Call: 5-5555");
+
+    // Suction and case details share the bottom band
+    const qreal bottomTop = emergencyRect.bottom() + 14;
+    const qreal columnWidth = (contentWidth - PADDING) / 2.0;
+    const qreal bottomHeight = CARD_HEIGHT - bottomTop - PADDING;
+
+    painter->setPen(QColor("#0066CC"));
+    painter->setFont(makeFont(26, true));
+    painter->drawText(QRectF(PADDING, bottomTop, columnWidth, bottomHeight),
+                      Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap,
+                      BaseDisplayView::formatSuctionInfo(displayCase.getSuction()));
+
+    painter->setPen(QColor("#333333"));
+    painter->setFont(makeFont(24, false));
+    painter->drawText(QRectF(PADDING * 2 + columnWidth, bottomTop, columnWidth, bottomHeight),
+                      Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap, caseDetails(displayCase));
+
+    painter->restore();
+}
\ No newline at end of file
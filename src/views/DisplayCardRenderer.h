@@ -0,0 +1,24 @@
+#ifndef DISPLAYCARDRENDERER_H
+#define DISPLAYCARDRENDERER_H
+
+#include <QImage>
+#include <QRectF>
+#include <QSizeF>
+#include "models/Case.h"
+
+class QPainter;
+
+// Paints a case's display card with QPainter alone, so cards can be rendered
+// into images on worker threads. The text comes from the same helpers that
+// BaseDisplayView::updateDisplay uses.
+class DisplayCardRenderer
+{
+public:
+    // Logical card size; painting scales it uniformly to the target
+    static QSizeF cardSize();
+
+    static QImage render(const Case& displayCase, const QSize& size, qreal devicePixelRatio);
+    static void paint(QPainter* painter, const Case& displayCase, const QRectF& targetRect);
+};
+
+#endif // DISPLAYCARDRENDERER_H
\ No newline at end of file
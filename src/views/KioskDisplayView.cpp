@@ -0,0 +1,161 @@
+#include "KioskDisplayView.h"
+#include "BaseDisplayView.h"
+#include "core/CaseManager.h"
+#include <QPainter>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QFileInfo>
+#include <QLayout>
+
+KioskDisplayView::KioskDisplayView(CaseManager* caseManager, QWidget* parent)
+    : QWidget(parent)
+    , caseManager_(caseManager)
+    , displayView_(nullptr)
+    , cardDirty_(false)
+{
+    setFocusPolicy(Qt::StrongFocus);
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    connect(caseManager_, &CaseManager::caseFileChanged, this, &KioskDisplayView::onCaseFileChanged);
+}
+
+KioskDisplayView::~KioskDisplayView()
+{
+    // The off-screen display view has no parent
+    delete displayView_;
+}
+
+bool KioskDisplayView::showCaseFile(const QString& filePath, QString* errorMessage)
+{
+    setFilePath(filePath);
+    return reloadCase(errorMessage);
+}
+
+void KioskDisplayView::showCase(const Case& case_)
+{
+    setFilePath(case_.getFilePath());
+    setDisplayCase(case_);
+}
+
+void KioskDisplayView::setFilePath(const QString& filePath)
+{
+    QString path = QFileInfo(filePath).absoluteFilePath();
+    if (path != filePath_) {
+        clear();
+        filePath_ = path;
+        caseManager_->watchCaseFile(filePath_);
+    }
+}
+
+void KioskDisplayView::clear()
+{
+    if (!filePath_.isEmpty()) {
+        caseManager_->unwatchCaseFile(filePath_);
+        filePath_.clear();
+    }
+
+    delete displayView_;
+    displayView_ = nullptr;
+    card_ = QPixmap();
+    cardDirty_ = false;
+}
+
+bool KioskDisplayView::reloadCase(QString* errorMessage)
+{
+    Case case_;
+    if (!CaseManager::readCaseFile(filePath_, case_, errorMessage)) {
+        return false;
+    }
+
+    case_.setFilePath(filePath_);
+    setDisplayCase(case_);
+    return true;
+}
+
+void KioskDisplayView::setDisplayCase(const Case& case_)
+{
+    if (!displayView_ || displayView_->getCase().getCaseType() != case_.getCaseType()) {
+        delete displayView_;
+
+        // Laid out as a real window that is never put on screen
+        displayView_ = BaseDisplayView::create(case_.getCaseType());
+        displayView_->setControlsVisible(false);
+        displayView_->setAttribute(Qt::WA_DontShowOnScreen);
+        displayView_->show();
+    }
+
+    displayView_->setCase(case_);
+    cardDirty_ = true;
+    update();
+}
+
+void KioskDisplayView::renderCard()
+{
+    cardDirty_ = false;
+    if (!displayView_ || size().isEmpty()) {
+        card_ = QPixmap();
+        return;
+    }
+
+    displayView_->resize(size());
+    if (displayView_->layout()) {
+        displayView_->layout()->activate();
+    }
+
+    const qreal ratio = devicePixelRatioF();
+    card_ = QPixmap(size() * ratio);
+    card_.setDevicePixelRatio(ratio);
+    card_.fill(Qt::white);
+    displayView_->render(&card_);
+}
+
+void KioskDisplayView::paintEvent(QPaintEvent* event)
+{
+    Q_UNUSED(event)
+
+    if (cardDirty_) {
+        renderCard();
+    }
+
+    QPainter painter(this);
+    if (card_.isNull()) {
+        painter.fillRect(rect(), Qt::white);
+        return;
+    }
+    painter.drawPixmap(0, 0, card_);
+}
+
+void KioskDisplayView::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+    if (displayView_) {
+        cardDirty_ = true;
+    }
+}
+
+void KioskDisplayView::keyPressEvent(QKeyEvent* event)
+{
+    if (event->key() == Qt::Key_Escape) {
+        emit exitRequested();
+        event->accept();
+        return;
+    }
+
+    QWidget::keyPressEvent(event);
+}
+
+void KioskDisplayView::mouseDoubleClickEvent(QMouseEvent* event)
+{
+    // Touch screens have no keyboard; a double tap leaves display mode
+    Q_UNUSED(event)
+    emit exitRequested();
+}
+
+void KioskDisplayView::onCaseFileChanged(const QString& filePath)
+{
+    // A save in progress can leave the file briefly unreadable; the last card stays up
+    // and the next change notification picks up the finished file
+    if (filePath == filePath_) {
+        reloadCase();
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef KIOSKDISPLAYVIEW_H
+#define KIOSKDISPLAYVIEW_H
+
+#include <QWidget>
+#include <QPixmap>
+#include "models/Case.h"
+
+class CaseManager;
+class BaseDisplayView;
+
+// Full-screen bedside display of a single case. The display view is rendered
+// off-screen into a cached pixmap, so the screen is repainted from that pixmap
+// and the card is only rebuilt when the case file changes or the size does.
+// Nothing here runs a timer or an animation.
+class KioskDisplayView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit KioskDisplayView(CaseManager* caseManager, QWidget* parent = nullptr);
+    ~KioskDisplayView();
+
+    bool showCaseFile(const QString& filePath, QString* errorMessage = nullptr);
+    // Shows a case that may still be on its way to disk; later changes to
+    // its file are picked up as with showCaseFile
+    void showCase(const Case& case_);
+    void clear();
+
+    QString getFilePath() const { return filePath_; }
+
+signals:
+    void exitRequested();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+
+private slots:
+    void onCaseFileChanged(const QString& filePath);
+
+private:
+    CaseManager* caseManager_;
+    BaseDisplayView* displayView_;
+    QString filePath_;
+    QPixmap card_;
+    bool cardDirty_;
+
+    void setFilePath(const QString& filePath);
+    bool reloadCase(QString* errorMessage = nullptr);
+    void setDisplayCase(const Case& case_);
+    void renderCard();
+};
+
+#endif // KIOSKDISPLAYVIEW_H
@@ -0,0 +1,77 @@
+#include "LTRDisplayView.h"
+#include <QGroupBox>
+
+LTRDisplayView::LTRDisplayView(QWidget* parent)
+    : BaseDisplayView(CaseType::LTR, parent)
+    , procedureLabel_(nullptr)
+    , surgeryLabel_(nullptr)
+    , extubationLabel_(nullptr)
+    , suctionInfoLabel_(nullptr)
+{
+}
+
+void LTRDisplayView::setupCaseSpecificFields()
+{
+    // Procedure information
+    QGroupBox* procedureGroup = new QGroupBox("Procedure Information");
+    QVBoxLayout* procedureLayout = new QVBoxLayout(procedureGroup);
+
+    procedureLabel_ = new QLabel();
+    procedureLabel_->setAlignment(Qt::AlignCenter);
+    procedureLabel_->setStyleSheet("font-size: 32px; font-weight: bold; color: #333; padding: 15px;");
+    procedureLabel_->setWordWrap(true);
+
+    surgeryLabel_ = new QLabel();
+    surgeryLabel_->setAlignment(Qt::AlignCenter);
+    surgeryLabel_->setStyleSheet("font-size: 28px; color: #333; padding: 10px;");
+    surgeryLabel_->setWordWrap(true);
+
+    procedureLayout->addWidget(procedureLabel_);
+    procedureLayout->addWidget(surgeryLabel_);
+
+    // Extubation information
+    QGroupBox* extubationGroup = new QGroupBox("Extubation Information");
+    QVBoxLayout* extubationLayout = new QVBoxLayout(extubationGroup);
+
+    extubationLabel_ = new QLabel();
+    extubationLabel_->setAlignment(Qt::AlignCenter);
+    extubationLabel_->setStyleSheet("font-size: 28px; font-weight: bold; color: #FF6600; padding: 15px;");
+    extubationLabel_->setWordWrap(true);
+
+    extubationLayout->addWidget(extubationLabel_);
+
+    // Suction information
+    QGroupBox* suctionGroup = new QGroupBox("Suction Information");
+    QVBoxLayout* suctionLayout = new QVBoxLayout(suctionGroup);
+
+    suctionInfoLabel_ = new QLabel();
+    suctionInfoLabel_->setAlignment(Qt::AlignCenter);
+    suctionInfoLabel_->setStyleSheet("font-size: 28px; font-weight: bold; color: #0066CC; padding: 15px;");
+    suctionInfoLabel_->setWordWrap(true);
+
+    suctionLayout->addWidget(suctionInfoLabel_);
+
+    specificContentLayout_->addWidget(procedureGroup);
+    specificContentLayout_->addWidget(extubationGroup);
+    specificContentLayout_->addWidget(suctionGroup);
+    specificContentLayout_->addStretch();
+}
+
+void LTRDisplayView::updateDisplay()
+{
+    // Call base class implementation first
+    BaseDisplayView::updateDisplay();
+
+    // Update LTR-specific fields
+    procedureLabel_->setText(currentCase_.getProcedure());
+
+    QString surgeryText = QString("Surgeon: %1    Date of Surgery: %2")
+                          .arg(currentCase_.getSurgeon())
+                          .arg(currentCase_.getDateOfSurgery());
+    surgeryLabel_->setText(surgeryText);
+
+    QString extubationText = QString("Extubation Date: %1").arg(currentCase_.getExtubationDate());
+    extubationLabel_->setText(extubationText);
+
+    suctionInfoLabel_->setText(formatSuctionInfo(currentCase_.getSuction()));
+}
\ No newline at end of file
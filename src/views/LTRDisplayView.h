@@ -0,0 +1,25 @@
+#ifndef LTRDISPLAYVIEW_H
+#define LTRDISPLAYVIEW_H
+
+#include "BaseDisplayView.h"
+#include <QLabel>
+
+class LTRDisplayView : public BaseDisplayView
+{
+    Q_OBJECT
+
+public:
+    explicit LTRDisplayView(QWidget* parent = nullptr);
+
+protected:
+    void setupCaseSpecificFields() override;
+    void updateDisplay() override;
+
+private:
+    QLabel* procedureLabel_;
+    QLabel* surgeryLabel_;
+    QLabel* extubationLabel_;
+    QLabel* suctionInfoLabel_;
+};
+
+#endif // LTRDISPLAYVIEW_H
\ No newline at end of file
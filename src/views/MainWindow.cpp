@@ -1,16 +1,22 @@
 #include "MainWindow.h"
 #include "CaseSelectionView.h"
-#include "TracheostomyFormView.h"
-#include "NewTracheostomyFormView.h"
-#include "DifficultAirwayFormView.h"
-#include "LTRFormView.h"
+#include "BatchExportDialog.h"
+#include "KioskDisplayView.h"
+#include "WallDisplayView.h"
+#include "StallDiagnosticsDialog.h"
 #include "widgets/BaseFormWidget.h"
 #include "widgets/NotificationWidget.h"
 #include "widgets/EscOverlayMenu.h"
+#include "widgets/EmergencyOverlayService.h"
 #include "core/Application.h"
 #include "core/CaseManager.h"
+#include "core/AutoSaveScheduler.h"
+#include "core/EmergencyProtocolLoader.h"
+#include "core/StallMonitor.h"
+#include "core/FootprintReport.h"
 #include "utils/StyleManager.h"
 #include "utils/ConfigManager.h"
+#include "utils/TubeCatalog.h"
 #include <QAction>
 #include <QMenu>
 #include <QMessageBox>
@@ -18,21 +24,27 @@
 #include <QCloseEvent>
 #include <QKeyEvent>
 #include <QApplication>
+#include <QElapsedTimer>
+#include <QProgressDialog>
 
 MainWindow::MainWindow(QWidget* parent)
     : QMainWindow(parent)
     , stackedWidget_(nullptr)
     , caseSelectionView_(nullptr)
-    , tracheostomyFormView_(nullptr)
-    , newTracheostomyFormView_(nullptr)
-    , difficultAirwayFormView_(nullptr)
-    , ltrFormView_(nullptr)
+    , formView_(nullptr)
+    , kioskDisplayView_(nullptr)
+    , wallDisplayView_(nullptr)
     , menuBar_(nullptr)
     , notificationWidget_(nullptr)
     , escOverlayMenu_(nullptr)
-    , autoSaveTimer_(nullptr)
+    , autoSaveScheduler_(nullptr)
     , caseManager_(nullptr)
     , hasUnsavedChanges_(false)
+    , lastSaveGeneration_(0)
+    , closeProgress_(nullptr)
+    , closeAfterWrites_(false)
+    , writeFailedWhileClosing_(false)
+    , displayReturnIndex_(CaseSelectionViewIndex)
 {
     caseManager_ = Application::instance().getCaseManager();
     
@@ -72,23 +84,28 @@ void MainWindow::setupUI()
     stackedWidget_ = new QStackedWidget();
     setCentralWidget(stackedWidget_);
     
-    caseSelectionView_ = new CaseSelectionView();
-    tracheostomyFormView_ = new TracheostomyFormView();
-    newTracheostomyFormView_ = new NewTracheostomyFormView();
-    difficultAirwayFormView_ = new DifficultAirwayFormView();
-    ltrFormView_ = new LTRFormView();
-    
-    // Complete the setup of form-specific fields after derived class construction
-    tracheostomyFormView_->finishSetup();
-    newTracheostomyFormView_->finishSetup();
-    difficultAirwayFormView_->finishSetup();
-    ltrFormView_->finishSetup();
+    // Each view's build is sampled for the footprint report
+    {
+        FootprintReport::BuildScope scope("CaseSelectionView");
+        caseSelectionView_ = new CaseSelectionView();
+    }
+    {
+        FootprintReport::BuildScope scope("BaseFormWidget");
+        formView_ = new BaseFormWidget();
+    }
+    {
+        FootprintReport::BuildScope scope("KioskDisplayView");
+        kioskDisplayView_ = new KioskDisplayView(caseManager_);
+    }
+    {
+        FootprintReport::BuildScope scope("WallDisplayView");
+        wallDisplayView_ = new WallDisplayView(caseManager_);
+    }
     
     stackedWidget_->addWidget(caseSelectionView_);
-    stackedWidget_->addWidget(tracheostomyFormView_);
-    stackedWidget_->addWidget(newTracheostomyFormView_);
-    stackedWidget_->addWidget(difficultAirwayFormView_);
-    stackedWidget_->addWidget(ltrFormView_);
+    stackedWidget_->addWidget(formView_);
+    stackedWidget_->addWidget(kioskDisplayView_);
+    stackedWidget_->addWidget(wallDisplayView_);
 }
 
 void MainWindow::setupMenuBar()
@@ -122,6 +139,10 @@ void MainWindow::setupMenuBar()
     connect(saveAsAction, &QAction::triggered, this, &MainWindow::onMenuFileSaveAs);
     fileMenu->addAction(saveAsAction);
     
+    QAction* batchPrintAction = new QAction("&Print Case Cards...", this);
+    connect(batchPrintAction, &QAction::triggered, this, &MainWindow::onBatchPrintRequested);
+    fileMenu->addAction(batchPrintAction);
+    
     fileMenu->addSeparator();
     
     QAction* exitAction = new QAction("E&xit", this);
@@ -145,6 +166,39 @@ void MainWindow::setupMenuBar()
     connect(resetFontAction, &QAction::triggered, this, &MainWindow::onMenuViewResetFontSize);
     viewMenu->addAction(resetFontAction);
     
+    viewMenu->addSeparator();
+    
+    QAction* displayModeAction = new QAction("&Display Mode", this);
+    connect(displayModeAction, &QAction::triggered, this, &MainWindow::onDisplayModeRequested);
+    viewMenu->addAction(displayModeAction);
+    
+    QAction* wallDisplayAction = new QAction("&Wall Display", this);
+    connect(wallDisplayAction, &QAction::triggered, this, &MainWindow::showWallDisplay);
+    viewMenu->addAction(wallDisplayAction);
+    
+    QMenu* debugMenu = menuBar_->addMenu("&Debug");
+    
+    QAction* stallDiagnosticsAction = new QAction("&Stall Diagnostics...", this);
+    stallDiagnosticsAction->setShortcut(QKeySequence("Ctrl+Shift+D"));
+    connect(stallDiagnosticsAction, &QAction::triggered, this, &MainWindow::onMenuDebugStallDiagnostics);
+    debugMenu->addAction(stallDiagnosticsAction);
+    
+    QAction* footprintReportAction = new QAction("&Footprint Report...", this);
+    footprintReportAction->setShortcut(QKeySequence("Ctrl+Shift+F"));
+    connect(footprintReportAction, &QAction::triggered, this, &MainWindow::onMenuDebugFootprintReport);
+    debugMenu->addAction(footprintReportAction);
+    
+    // The menu bar is hidden, so the window needs the action for its shortcut
+    addAction(stallDiagnosticsAction);
+    addAction(footprintReportAction);
+    
+    // Emergency scenarios open from any view, even while another window has focus
+    QAction* emergencyAction = new QAction("&Emergency Scenarios", this);
+    emergencyAction->setShortcuts({ QKeySequence(Qt::Key_F1), QKeySequence("Ctrl+E") });
+    emergencyAction->setShortcutContext(Qt::ApplicationShortcut);
+    connect(emergencyAction, &QAction::triggered, this, &MainWindow::onEmergencyOverlayRequested);
+    addAction(emergencyAction);
+    
     QMenu* helpMenu = menuBar_->addMenu("&Help");
     
     QAction* aboutAction = new QAction("&About Safe Airway", this);
@@ -160,6 +214,10 @@ void MainWindow::setupNotifications()
 void MainWindow::setupEscOverlay()
 {
     escOverlayMenu_ = new EscOverlayMenu(this);
+    
+    // One emergency overlay for every view; forms bind it when shown
+    FootprintReport::BuildScope scope("EmergencyPanelOverlay");
+    EmergencyOverlayService::instance().attach(this);
 }
 
 void MainWindow::setupConnections()
@@ -167,33 +225,39 @@ void MainWindow::setupConnections()
     connect(caseSelectionView_, &CaseSelectionView::newCaseRequested, this, &MainWindow::onNewCaseRequested);
     connect(caseSelectionView_, &CaseSelectionView::existingCaseSelected, this, &MainWindow::onExistingCaseSelected);
     
-    connect(tracheostomyFormView_, &TracheostomyFormView::saveRequested, this, &MainWindow::onSaveRequested);
-    connect(newTracheostomyFormView_, &NewTracheostomyFormView::saveRequested, this, &MainWindow::onSaveRequested);
-    connect(difficultAirwayFormView_, &DifficultAirwayFormView::saveRequested, this, &MainWindow::onSaveRequested);
-    connect(ltrFormView_, &LTRFormView::saveRequested, this, &MainWindow::onSaveRequested);
-    
-    // Connect back button signals
-    connect(tracheostomyFormView_, &TracheostomyFormView::backRequested, this, &MainWindow::onBackRequested);
-    connect(newTracheostomyFormView_, &NewTracheostomyFormView::backRequested, this, &MainWindow::onBackRequested);
-    connect(difficultAirwayFormView_, &DifficultAirwayFormView::backRequested, this, &MainWindow::onBackRequested);
-    connect(ltrFormView_, &LTRFormView::backRequested, this, &MainWindow::onBackRequested);
+    connect(formView_, &BaseFormWidget::saveRequested, this, &MainWindow::onSaveRequested);
+    connect(formView_, &BaseFormWidget::backRequested, this, &MainWindow::onBackRequested);
+    connect(formView_, &BaseFormWidget::displayRequested, this, &MainWindow::onDisplayRequested);
+    connect(kioskDisplayView_, &KioskDisplayView::exitRequested, this, &MainWindow::onKioskExitRequested);
+    connect(wallDisplayView_, &WallDisplayView::exitRequested, this, &MainWindow::onWallExitRequested);
     
-    connect(tracheostomyFormView_, &TracheostomyFormView::formChanged, this, [this]() { setUnsavedChanges(true); });
-    connect(newTracheostomyFormView_, &NewTracheostomyFormView::formChanged, this, [this]() { setUnsavedChanges(true); });
-    connect(difficultAirwayFormView_, &DifficultAirwayFormView::formChanged, this, [this]() { setUnsavedChanges(true); });
-    connect(ltrFormView_, &LTRFormView::formChanged, this, [this]() { setUnsavedChanges(true); });
+    connect(formView_, &BaseFormWidget::formChanged, this, [this]() { setUnsavedChanges(true); });
     
     connect(caseManager_, &CaseManager::caseSaved, this, &MainWindow::onCaseSaved);
+    connect(caseManager_, &CaseManager::caseExported, this, [this](const QString& filePath) {
+        showSuccessNotification("Case saved as: " + filePath);
+    });
     connect(caseManager_, &CaseManager::error, this, [this](const QString& message) {
         QMessageBox::critical(this, "Error", message);
         showErrorNotification("Error: " + message);
     });
+
+    // A bad data file keeps the previous tables; no need to interrupt
+    connect(&TubeCatalog::instance(), &TubeCatalog::error, this, [this](const QString& message) {
+        showErrorNotification(message);
+    });
+    connect(&EmergencyProtocolLoader::instance(), &EmergencyProtocolLoader::error, this, [this](const QString& message) {
+        showErrorNotification(message);
+    });
     
     // ESC Overlay Menu connections
     connect(escOverlayMenu_, &EscOverlayMenu::newCaseRequested, this, &MainWindow::onOverlayNewCaseRequested);
     connect(escOverlayMenu_, &EscOverlayMenu::openCaseRequested, this, &MainWindow::onOverlayOpenCaseRequested);
     connect(escOverlayMenu_, &EscOverlayMenu::saveRequested, this, &MainWindow::onOverlaySaveRequested);
     connect(escOverlayMenu_, &EscOverlayMenu::saveAsRequested, this, &MainWindow::onOverlaySaveAsRequested);
+    connect(escOverlayMenu_, &EscOverlayMenu::batchPrintRequested, this, &MainWindow::onBatchPrintRequested);
+    connect(escOverlayMenu_, &EscOverlayMenu::displayModeRequested, this, &MainWindow::onDisplayModeRequested);
+    connect(escOverlayMenu_, &EscOverlayMenu::wallDisplayRequested, this, &MainWindow::showWallDisplay);
     connect(escOverlayMenu_, &EscOverlayMenu::increaseFontRequested, this, &MainWindow::onOverlayIncreaseFontRequested);
     connect(escOverlayMenu_, &EscOverlayMenu::decreaseFontRequested, this, &MainWindow::onOverlayDecreaseFontRequested);
     connect(escOverlayMenu_, &EscOverlayMenu::resetFontRequested, this, &MainWindow::onOverlayResetFontRequested);
@@ -203,13 +267,41 @@ void MainWindow::setupConnections()
 
 void MainWindow::setupAutoSave()
 {
-    autoSaveTimer_ = new QTimer(this);
-    connect(autoSaveTimer_, &QTimer::timeout, this, &MainWindow::onAutoSaveTimer);
-    
-    int interval = ConfigManager::instance().getAutoSaveInterval();
-    if (interval > 0) {
-        autoSaveTimer_->start(interval * 60 * 1000);
-    }
+    autoSaveScheduler_ = new AutoSaveScheduler(this);
+    autoSaveScheduler_->setMaxDelayMinutes(ConfigManager::instance().getAutoSaveInterval());
+    connect(autoSaveScheduler_, &AutoSaveScheduler::saveDue, this, &MainWindow::onAutoSaveDue);
+    connect(caseManager_, &CaseManager::writesFinished, this, &MainWindow::onWritesFinished);
+
+    connect(formView_, &BaseFormWidget::formChanged, autoSaveScheduler_, &AutoSaveScheduler::markDirty);
+
+    // Nothing is saved behind the emergency overlay
+    connect(&EmergencyOverlayService::instance(), &EmergencyOverlayService::overlayVisibilityChanged, this,
+            [this](bool visible) {
+        if (visible) {
+            autoSaveScheduler_->pause(AutoSaveScheduler::EmergencyOverlayPause);
+        } else {
+            autoSaveScheduler_->resume(AutoSaveScheduler::EmergencyOverlayPause);
+        }
+    });
+
+    connect(caseManager_, &CaseManager::saveFailed, this,
+            [this](const QString&, quint64 generation, const QString& message, bool autoSave) {
+        if (closeAfterWrites_) {
+            writeFailedWhileClosing_ = true;
+        }
+        // A newer write of the case is still queued; only the last one counts
+        if (generation == lastSaveGeneration_) {
+            // The edits are still only in the form; try again after the next one
+            setUnsavedChanges(true);
+            formView_->setJustSaved(false);
+        }
+        // A failed save the user asked for needs acknowledging; an autosave retries on its own
+        if (autoSave) {
+            showErrorNotification(message);
+        } else {
+            QMessageBox::critical(this, "Error", message);
+        }
+    });
 }
 
 void MainWindow::showCaseSelectionView()
@@ -217,72 +309,35 @@ void MainWindow::showCaseSelectionView()
     stackedWidget_->setCurrentIndex(CaseSelectionViewIndex);
     setUnsavedChanges(false); // Clear unsaved changes when returning to case selection
     currentFilePath_.clear(); // Clear current file path
+    autoSaveScheduler_->markSaved();
     updateWindowTitle();
 }
 
-void MainWindow::showFormView(CaseType caseType)
+void MainWindow::showFormView()
 {
-    switch (caseType) {
-    case CaseType::Tracheostomy:
-        stackedWidget_->setCurrentIndex(TracheostomyFormViewIndex);
-        break;
-    case CaseType::NewTracheostomy:
-        stackedWidget_->setCurrentIndex(NewTracheostomyFormViewIndex);
-        break;
-    case CaseType::DifficultAirway:
-        stackedWidget_->setCurrentIndex(DifficultAirwayFormViewIndex);
-        break;
-    case CaseType::LTR:
-        stackedWidget_->setCurrentIndex(LTRFormViewIndex);
-        break;
-    }
+    stackedWidget_->setCurrentIndex(FormViewIndex);
     updateWindowTitle();
 }
 
 void MainWindow::onNewCaseRequested(CaseType caseType)
 {
-    QWidget* currentWidget = stackedWidget_->currentWidget();
-    BaseFormWidget* currentFormWidget = nullptr;
-    
-    // Check current form's save status if we're on a form
-    if (currentWidget == tracheostomyFormView_) {
-        currentFormWidget = tracheostomyFormView_;
-    } else if (currentWidget == newTracheostomyFormView_) {
-        currentFormWidget = newTracheostomyFormView_;
-    } else if (currentWidget == difficultAirwayFormView_) {
-        currentFormWidget = difficultAirwayFormView_;
-    } else if (currentWidget == ltrFormView_) {
-        currentFormWidget = ltrFormView_;
-    }
+    // Check the form's save status if we're on it
+    bool onForm = stackedWidget_->currentWidget() == formView_;
     
     // Only prompt if there are unsaved changes and the form wasn't just saved
-    if (currentFormWidget && !currentFormWidget->wasJustSaved() && hasUnsavedChanges_) {
+    if (onForm && !formView_->wasJustSaved() && hasUnsavedChanges_) {
         if (!promptSaveChanges()) {
             return;
         }
     }
     
-    Case newCase;  // Use default constructor to generate UUID
-    newCase.setCaseType(caseType);
+    Case newCase = Case::createNew(caseType);
     currentFilePath_.clear();
+    autoSaveScheduler_->markSaved();
     setUnsavedChanges(false);
     
-    switch (caseType) {
-    case CaseType::Tracheostomy:
-        tracheostomyFormView_->setCase(newCase);
-        break;
-    case CaseType::NewTracheostomy:
-        newTracheostomyFormView_->setCase(newCase);
-        break;
-    case CaseType::DifficultAirway:
-        difficultAirwayFormView_->setCase(newCase);
-        break;
-    case CaseType::LTR:
-        ltrFormView_->setCase(newCase);
-        break;
-    }
-    
-    showFormView(caseType);
+    formView_->setCase(newCase);
+    showFormView();
     showSuccessNotification("New case created");
 }
 
@@ -297,10 +352,10 @@ void MainWindow::onExistingCaseSelected(const QString& filePath)
 
 void MainWindow::onCaseSaved(const QString& filePath)
 {
-    currentFilePath_ = filePath;
-    setUnsavedChanges(false);
+    // The form was marked saved when the write was queued; edits made since
+    // then, or another case opened meanwhile, must not be cleared here
+    Q_UNUSED(filePath);
     showSuccessNotification("Case saved successfully");
-    updateWindowTitle();
 }
 
 void MainWindow::onSaveRequested()
@@ -319,22 +374,9 @@ void MainWindow::onBackToSelection()
 
 void MainWindow::onBackRequested()
 {
-    QWidget* currentWidget = stackedWidget_->currentWidget();
-    BaseFormWidget* formWidget = nullptr;
-    
-    if (currentWidget == tracheostomyFormView_) {
-        formWidget = tracheostomyFormView_;
-    } else if (currentWidget == newTracheostomyFormView_) {
-        formWidget = newTracheostomyFormView_;
-    } else if (currentWidget == difficultAirwayFormView_) {
-        formWidget = difficultAirwayFormView_;
-    } else if (currentWidget == ltrFormView_) {
-        formWidget = ltrFormView_;
-    }
-    
-    if (formWidget) {
+    if (stackedWidget_->currentWidget() == formView_) {
         // If just saved, or if there are no unsaved changes, go back directly
-        if (formWidget->wasJustSaved() || !hasUnsavedChanges_) {
+        if (formView_->wasJustSaved() || !hasUnsavedChanges_) {
             showCaseSelectionView();
         } else {
             // There are unsaved changes, prompt user
@@ -348,16 +390,23 @@ void MainWindow::onBackRequested()
     }
 }
 
-void MainWindow::onAutoSaveTimer()
+void MainWindow::onAutoSaveDue()
 {
-    if (hasUnsavedChanges_ && !currentFilePath_.isEmpty()) {
-        saveCurrentCase();
-        showNotification("Auto-saved");
-    }
+    // Only cases that were saved once are autosaved
+    if (stackedWidget_->currentWidget() != formView_ || currentFilePath_.isEmpty()) return;
+
+    // The writer skips the write if the edits left the case as it is on disk
+    Case case_ = formView_->getCase();
+    case_.setUpdatedAt(QDateTime::currentDateTime());
+    QString filePath = caseManager_->autoSaveCase(case_, &lastSaveGeneration_);
+    formView_->markSaved(filePath, case_.getUpdatedAt());
+    autoSaveScheduler_->markSaved();
+    setUnsavedChanges(false);
 }
 
 void MainWindow::loadCase(const QString& filePath)
 {
+    StallMonitor::Scope scope("MainWindow::loadCase");
     Case case_;
     if (!caseManager_->loadCase(filePath, case_)) {
         QMessageBox::critical(this, "Error", "Failed to load case from: " + filePath);
@@ -366,64 +415,43 @@ void MainWindow::loadCase(const QString& filePath)
 
     currentFilePath_ = filePath;
     case_.setFilePath(filePath);  // Set the file path in the case
+    autoSaveScheduler_->markSaved();
     setUnsavedChanges(false);
 
-    switch (case_.getCaseType()) {
-    case CaseType::Tracheostomy:
-        tracheostomyFormView_->setCase(case_);
-        break;
-    case CaseType::NewTracheostomy:
-        newTracheostomyFormView_->setCase(case_);
-        break;
-    case CaseType::DifficultAirway:
-        difficultAirwayFormView_->setCase(case_);
-        break;
-    case CaseType::LTR:
-        ltrFormView_->setCase(case_);
-        break;
-    }
-
-    showFormView(case_.getCaseType());
+    // The form switches to the case's type as it loads
+    formView_->setCase(case_);
+    showFormView();
     showSuccessNotification("Case loaded successfully");
 }
 
 void MainWindow::saveCurrentCase()
 {
-    QWidget* currentWidget = stackedWidget_->currentWidget();
-    if (!currentWidget) return;
+    StallMonitor::Scope scope("MainWindow::saveCurrentCase");
+    BaseFormWidget* formWidget = qobject_cast<BaseFormWidget*>(stackedWidget_->currentWidget());
+    if (!formWidget) return;
 
-    Case case_;
+    QElapsedTimer saveTimer;
+    saveTimer.start();
 
-    if (currentWidget == tracheostomyFormView_) {
-        case_ = tracheostomyFormView_->getCase();
-    } else if (currentWidget == newTracheostomyFormView_) {
-        case_ = newTracheostomyFormView_->getCase();
-    } else if (currentWidget == difficultAirwayFormView_) {
-        case_ = difficultAirwayFormView_->getCase();
-    } else if (currentWidget == ltrFormView_) {
-        case_ = ltrFormView_->getCase();
-    } else {
-        return;
-    }
+    // A snapshot of the form's edit model; only dirty fields are re-read.
+    // Serializing and writing it happen on the case writer thread.
+    Case case_ = formWidget->getCase();
+    case_.setUpdatedAt(QDateTime::currentDateTime());
 
-    QString filePath = caseManager_->saveCase(case_);
-    if (!filePath.isEmpty()) {
-        currentFilePath_ = filePath;
-        // Ensure the case has the correct filePath for future saves
-        case_.setFilePath(filePath);
-
-        // Update the case in the form views with the filePath
-        if (currentWidget == tracheostomyFormView_) {
-            tracheostomyFormView_->setCase(case_);
-        } else if (currentWidget == newTracheostomyFormView_) {
-            newTracheostomyFormView_->setCase(case_);
-        } else if (currentWidget == difficultAirwayFormView_) {
-            difficultAirwayFormView_->setCase(case_);
-        } else if (currentWidget == ltrFormView_) {
-            ltrFormView_->setCase(case_);
-        }
-        setUnsavedChanges(false);
-        updateWindowTitle();
+    QString filePath = caseManager_->saveCase(case_, &lastSaveGeneration_);
+    currentFilePath_ = filePath;
+    // The form keeps its widgets; it only needs the path for future saves
+    formWidget->markSaved(filePath, case_.getUpdatedAt());
+    autoSaveScheduler_->markSaved();
+    setUnsavedChanges(false);
+    updateWindowTitle();
+
+    // Save-to-idle, logged only with stall diagnostics on: the zero timer
+    // fires once the work queued by the save has drained
+    if (StallMonitor::instance().isRunning()) {
+        QTimer::singleShot(0, this, [saveTimer]() {
+            qInfo("Save to idle: %.2f ms", saveTimer.nsecsElapsed() / 1.0e6);
+        });
     }
 }
 
@@ -438,28 +466,19 @@ bool MainWindow::saveAsCase()
         return false;
     }
     
-    QWidget* currentWidget = stackedWidget_->currentWidget();
-    if (!currentWidget) return false;
-    
-    Case case_;
-    
-    if (currentWidget == tracheostomyFormView_) {
-        case_ = tracheostomyFormView_->getCase();
-    } else if (currentWidget == newTracheostomyFormView_) {
-        case_ = newTracheostomyFormView_->getCase();
-    } else if (currentWidget == difficultAirwayFormView_) {
-        case_ = difficultAirwayFormView_->getCase();
-    } else if (currentWidget == ltrFormView_) {
-        case_ = ltrFormView_->getCase();
-    } else {
+    if (stackedWidget_->currentWidget() != formView_) {
         return false;
     }
     
-    if (caseManager_->exportCase(case_, fileName)) {
+    Case case_ = formView_->getCase();
+    case_.setUpdatedAt(QDateTime::currentDateTime());
+    
+    // caseExported or saveFailed reports the outcome once it is written
+    if (caseManager_->exportCase(case_, fileName, &lastSaveGeneration_)) {
         currentFilePath_ = fileName;
+        autoSaveScheduler_->markSaved();
         setUnsavedChanges(false);
         updateWindowTitle();
-        showSuccessNotification("Case saved as: " + fileName);
         return true;
     }
     
@@ -505,6 +524,8 @@ void MainWindow::showSuccessNotification(const QString& message)
 
 void MainWindow::setUnsavedChanges(bool hasChanges)
 {
+    // Every keystroke lands here; only touch the title when the flag flips
+    if (hasUnsavedChanges_ == hasChanges) return;
     hasUnsavedChanges_ = hasChanges;
     updateWindowTitle();
 }
@@ -520,6 +541,8 @@ bool MainWindow::promptSaveChanges()
         saveCurrentCase();
         return true;
     } else if (reply == QMessageBox::Discard) {
+        autoSaveScheduler_->markSaved();
+        setUnsavedChanges(false);
         return true;
     }
     
@@ -535,14 +558,48 @@ void MainWindow::applyFontSize(int size)
 
 void MainWindow::closeEvent(QCloseEvent* event)
 {
+    if (closeAfterWrites_) {
+        event->ignore();
+        return;
+    }
+    
     if (hasUnsavedChanges_ && !promptSaveChanges()) {
         event->ignore();
         return;
     }
     
+    // Queued writes must land before the window goes; onWritesFinished
+    // closes it again once they have, without blocking the event loop
+    if (caseManager_->pendingWrites() > 0) {
+        if (!closeProgress_) {
+            closeProgress_ = new QProgressDialog("Saving cases before closing...", "Cancel", 0, 0, this);
+            closeProgress_->setWindowTitle("Safe Airway");
+            closeProgress_->setWindowModality(Qt::WindowModal);
+            closeProgress_->setMinimumDuration(0);
+            connect(closeProgress_, &QProgressDialog::canceled, this, [this]() { closeAfterWrites_ = false; });
+        }
+        closeAfterWrites_ = true;
+        writeFailedWhileClosing_ = false;
+        closeProgress_->show();
+        event->ignore();
+        return;
+    }
+    
     event->accept();
 }
 
+void MainWindow::onWritesFinished()
+{
+    if (!closeAfterWrites_) return;
+    closeAfterWrites_ = false;
+    closeProgress_->hide();
+    
+    // A failed write was reported as it came in; its edits stay open here
+    if (!writeFailedWhileClosing_) {
+        close();
+    }
+}
+
 void MainWindow::keyPressEvent(QKeyEvent* event)
 {
     if (event->key() == Qt::Key_Escape) {
@@ -583,6 +640,115 @@ void MainWindow::onMenuFileSaveAs()
     saveAsCase();
 }
 
+void MainWindow::onBatchPrintRequested()
+{
+    BatchExportDialog dialog(caseManager_, this);
+    dialog.exec();
+}
+
+void MainWindow::onDisplayRequested()
+{
+    // The display follows the case file, so pending edits are saved first
+    if (hasUnsavedChanges_ || currentFilePath_.isEmpty()) {
+        saveCurrentCase();
+    }
+    
+    if (currentFilePath_.isEmpty()) {
+        showErrorNotification("Save the case before opening the display");
+        return;
+    }
+    
+    // The write may still be queued, so the display starts from the form's
+    // snapshot rather than whatever is on disk
+    kioskDisplayView_->showCase(formView_->getCase());
+    enterKioskDisplay();
+}
+
+void MainWindow::onDisplayModeRequested()
+{
+    if (qobject_cast<BaseFormWidget*>(stackedWidget_->currentWidget())) {
+        onDisplayRequested();
+        return;
+    }
+    
+    QString fileName = QFileDialog::getOpenFileName(this, 
+        "Display Case", 
+        caseManager_->getBasePath(),
+        "JSON files (*.json)");
+    
+    if (!fileName.isEmpty()) {
+        showKioskDisplay(fileName);
+    }
+}
+
+bool MainWindow::showKioskDisplay(const QString& filePath)
+{
+    QString errorMessage;
+    if (!kioskDisplayView_->showCaseFile(filePath, &errorMessage)) {
+        QMessageBox::critical(this, "Error", "Failed to display case from: " + filePath + "\n" + errorMessage);
+        return false;
+    }
+    
+    enterKioskDisplay();
+    return true;
+}
+
+void MainWindow::enterKioskDisplay()
+{
+    if (stackedWidget_->currentIndex() == WallViewIndex) {
+        wallDisplayView_->stop();
+    }
+    
+    enterDisplayMode(KioskViewIndex);
+    kioskDisplayView_->setFocus();
+}
+
+void MainWindow::showWallDisplay()
+{
+    if (stackedWidget_->currentIndex() == KioskViewIndex) {
+        kioskDisplayView_->clear();
+    }
+    
+    enterDisplayMode(WallViewIndex);
+    wallDisplayView_->start();
+    wallDisplayView_->setFocus();
+}
+
+void MainWindow::enterDisplayMode(int viewIndex)
+{
+    int currentIndex = stackedWidget_->currentIndex();
+    if (currentIndex != KioskViewIndex && currentIndex != WallViewIndex) {
+        displayReturnIndex_ = currentIndex;
+    }
+    
+    // Nothing is edited on the displays, so nothing is saved behind them
+    autoSaveScheduler_->pause(AutoSaveScheduler::DisplayModePause);
+    
+    stackedWidget_->setCurrentIndex(viewIndex);
+    showFullScreen();
+}
+
+void MainWindow::leaveDisplayMode()
+{
+    autoSaveScheduler_->resume(AutoSaveScheduler::DisplayModePause);
+    
+    stackedWidget_->setCurrentIndex(displayReturnIndex_);
+    showMaximized();
+    updateWindowTitle();
+}
+
+void MainWindow::onKioskExitRequested()
+{
+    kioskDisplayView_->clear();
+    leaveDisplayMode();
+}
+
+void MainWindow::onWallExitRequested()
+{
+    wallDisplayView_->stop();
+    leaveDisplayMode();
+}
+
 void MainWindow::onMenuFileExit()
 {
     close();
@@ -615,6 +781,58 @@ void MainWindow::onMenuHelpAbout()
         "© 2024 Nemours Children's Health");
 }
 
+void MainWindow::onMenuDebugStallDiagnostics()
+{
+    // Modeless so the form can be used while incidents come in
+    StallDiagnosticsDialog* dialog = new StallDiagnosticsDialog(this);
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->show();
+}
+
+QString MainWindow::footprintReport() const
+{
+    return FootprintReport::generate(this, stackedWidget_);
+}
+
+void MainWindow::onMenuDebugFootprintReport()
+{
+    QString defaultDir = ConfigManager::instance().getLastDirectory();
+    if (defaultDir.isEmpty()) {
+        defaultDir = caseManager_->getBasePath();
+    }
+    
+    QString fileName = QFileDialog::getSaveFileName(this,
+        "Save Footprint Report",
+        defaultDir + "/footprint-report.txt",
+        "Text files (*.txt)");
+    
+    if (fileName.isEmpty()) {
+        return;
+    }
+    
+    QString errorMessage;
+    if (!FootprintReport::write(footprintReport(), fileName, &errorMessage)) {
+        showErrorNotification(errorMessage);
+        return;
+    }
+    showSuccessNotification("Footprint report saved to " + fileName);
+}
+
+void MainWindow::onEmergencyOverlayRequested()
+{
+    if (escOverlayMenu_->isMenuVisible()) {
+        escOverlayMenu_->hideMenu();
+    }
+    
+    if (BaseFormWidget* form = qobject_cast<BaseFormWidget*>(stackedWidget_->currentWidget())) {
+        form->showEmergencyOverlay();
+        return;
+    }
+    
+    // General protocols on the views without a case form
+    EmergencyOverlayService::instance().showOverlay();
+}
+
 // ESC Overlay Menu slot implementations
 void MainWindow::onOverlayNewCaseRequested()
 {
@@ -10,13 +10,14 @@
 #include "models/Case.h"
 
 class CaseSelectionView;
-class TracheostomyFormView;
-class NewTracheostomyFormView;
-class DifficultAirwayFormView;
-class LTRFormView;
+class BaseFormWidget;
 class CaseManager;
 class NotificationWidget;
 class EscOverlayMenu;
+class KioskDisplayView;
+class WallDisplayView;
+class AutoSaveScheduler;
+class QProgressDialog;
 
 class MainWindow : public QMainWindow
 {
@@ -25,6 +26,15 @@ class MainWindow : public QMainWindow
 public:
     MainWindow(QWidget* parent = nullptr);
     ~MainWindow();
+    
+    // Shows a saved case full-screen as a bedside display card
+    bool showKioskDisplay(const QString& filePath);
+    
+    // Shows every active tracheostomy case as a grid of cards
+    void showWallDisplay();
+    
+    // See FootprintReport
+    QString footprintReport() const;
 
 protected:
     void closeEvent(QCloseEvent* event) override;
@@ -37,17 +47,26 @@ private slots:
     void onSaveRequested();
     void onBackToSelection();
     void onBackRequested();
-    void onAutoSaveTimer();
+    void onAutoSaveDue();
+    void onWritesFinished();
     
     void onMenuFileNew();
     void onMenuFileOpen();
     void onMenuFileSave();
     void onMenuFileSaveAs();
+    void onBatchPrintRequested();
+    void onDisplayRequested();
+    void onDisplayModeRequested();
+    void onKioskExitRequested();
+    void onWallExitRequested();
     void onMenuFileExit();
     void onMenuViewIncreaseFontSize();
     void onMenuViewDecreaseFontSize();
     void onMenuViewResetFontSize();
     void onMenuHelpAbout();
+    void onMenuDebugStallDiagnostics();
+    void onMenuDebugFootprintReport();
+    void onEmergencyOverlayRequested();
     
     // ESC Overlay Menu slots
     void onOverlayNewCaseRequested();
@@ -64,19 +83,29 @@ private:
     QStackedWidget* stackedWidget_;
     
     CaseSelectionView* caseSelectionView_;
-    TracheostomyFormView* tracheostomyFormView_;
-    NewTracheostomyFormView* newTracheostomyFormView_;
-    DifficultAirwayFormView* difficultAirwayFormView_;
-    LTRFormView* ltrFormView_;
+    // Shared by every case type; loading a case switches its type
+    BaseFormWidget* formView_;
+    KioskDisplayView* kioskDisplayView_;
+    WallDisplayView* wallDisplayView_;
     
     QMenuBar* menuBar_;
     NotificationWidget* notificationWidget_;
     EscOverlayMenu* escOverlayMenu_;
-    QTimer* autoSaveTimer_;
+    AutoSaveScheduler* autoSaveScheduler_;
     
     CaseManager* caseManager_;
     QString currentFilePath_;
     bool hasUnsavedChanges_;
+    // Generation of the newest queued write; older writes' failures are superseded
+    quint64 lastSaveGeneration_;
+    // A close waits for queued writes behind this dialog; any write that
+    // fails meanwhile keeps the window open
+    QProgressDialog* closeProgress_;
+    bool closeAfterWrites_;
+    bool writeFailedWhileClosing_;
+    
+    // Restored when leaving display mode
+    int displayReturnIndex_;
     
     void setupUI();
     void setupMenuBar();
@@ -86,7 +115,7 @@ private:
     void setupAutoSave();
     
     void showCaseSelectionView();
-    void showFormView(CaseType caseType);
+    void showFormView();
     void loadCase(const QString& filePath);
     void saveCase();
     void saveCurrentCase();
@@ -100,13 +129,15 @@ private:
     
     bool promptSaveChanges();
     void applyFontSize(int size);
+    void enterKioskDisplay();
+    void enterDisplayMode(int viewIndex);
+    void leaveDisplayMode();
     
     enum ViewIndex {
         CaseSelectionViewIndex = 0,
-        TracheostomyFormViewIndex = 1,
-        NewTracheostomyFormViewIndex = 2,
-        DifficultAirwayFormViewIndex = 3,
-        LTRFormViewIndex = 4
+        FormViewIndex = 1,
+        KioskViewIndex = 2,
+        WallViewIndex = 3
     };
 };
 
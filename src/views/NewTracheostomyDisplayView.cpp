@@ -61,9 +61,5 @@ void NewTracheostomyDisplayView::updateDisplay()
     QString extubationText = QString("Extubation Date: %1").arg(currentCase_.getExtubationDate());
     extubationLabel_->setText(extubationText);
 
-    SuctionInfo suction = currentCase_.getSuction();
-    QString suctionText = QString("Suction Catheter: %1 Fr\nSuction Depth: %2 cm")
-                          .arg(suction.size)
-                          .arg(suction.depth);
-    suctionInfoLabel_->setText(suctionText);
+    suctionInfoLabel_->setText(formatSuctionInfo(currentCase_.getSuction()));
 }
\ No newline at end of file
@@ -0,0 +1,266 @@
+#include "StallDiagnosticsDialog.h"
+#include "utils/ConfigManager.h"
+#include "widgets/EmergencyOverlayService.h"
+#include "widgets/EmergencyPanelOverlay.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QGuiApplication>
+#include <QClipboard>
+
+namespace {
+
+enum Column {
+    TimeColumn = 0,
+    DurationColumn,
+    ReceiverColumn,
+    EventColumn,
+    ScopeColumn,
+    ColumnCount
+};
+
+}
+
+StallDiagnosticsDialog::StallDiagnosticsDialog(QWidget* parent)
+    : QDialog(parent)
+    , statusLabel_(nullptr)
+    , monitorCheckBox_(nullptr)
+    , stackCheckBox_(nullptr)
+    , thresholdSpinBox_(nullptr)
+    , incidentTable_(nullptr)
+    , detailEdit_(nullptr)
+    , clearButton_(nullptr)
+    , copyButton_(nullptr)
+    , closeButton_(nullptr)
+{
+    setupUI();
+    connectSignals();
+    reload();
+}
+
+void StallDiagnosticsDialog::setupUI()
+{
+    setWindowTitle("Stall Diagnostics");
+    resize(1100, 700);
+    setStyleSheet(
+        "QDialog { background-color: white; }"
+        "QLabel, QCheckBox, QSpinBox { font-size: 18px; color: #2C3E50; }"
+        "QTableWidget { font-size: 16px; gridline-color: #CCCCCC; }"
+        "QHeaderView::section { background-color: #E6E6E6; font-size: 16px; font-weight: bold; padding: 4px; }"
+        "QPlainTextEdit { font-family: monospace; font-size: 14px; }"
+    );
+
+    QVBoxLayout* layout = new QVBoxLayout(this);
+    layout->setSpacing(12);
+    layout->setContentsMargins(20, 20, 20, 20);
+
+    StallMonitor& monitor = StallMonitor::instance();
+
+    QHBoxLayout* optionsLayout = new QHBoxLayout();
+    monitorCheckBox_ = new QCheckBox("Monitor the event loop");
+    monitorCheckBox_->setChecked(monitor.isRunning());
+    stackCheckBox_ = new QCheckBox("Sample stacks");
+    stackCheckBox_->setChecked(monitor.isStackSamplingEnabled());
+    stackCheckBox_->setEnabled(StallMonitor::isStackSamplingSupported() && monitor.isRunning());
+    if (!StallMonitor::isStackSamplingSupported()) {
+        stackCheckBox_->setToolTip("Stack sampling is only available on Linux");
+    }
+    thresholdSpinBox_ = new QSpinBox();
+    thresholdSpinBox_->setRange(10, 2000);
+    thresholdSpinBox_->setSuffix(" ms");
+    thresholdSpinBox_->setValue(monitor.getThresholdMs());
+
+    optionsLayout->addWidget(monitorCheckBox_);
+    optionsLayout->addWidget(stackCheckBox_);
+    optionsLayout->addStretch();
+    optionsLayout->addWidget(new QLabel("Threshold:"));
+    optionsLayout->addWidget(thresholdSpinBox_);
+    layout->addLayout(optionsLayout);
+
+    statusLabel_ = new QLabel();
+    statusLabel_->setStyleSheet("color: #546E7A;");
+    layout->addWidget(statusLabel_);
+
+    incidentTable_ = new QTableWidget(0, ColumnCount);
+    incidentTable_->setHorizontalHeaderLabels({"Time", "Duration", "Receiver", "Event", "Slow Scopes"});
+    incidentTable_->setSelectionBehavior(QAbstractItemView::SelectRows);
+    incidentTable_->setSelectionMode(QAbstractItemView::SingleSelection);
+    incidentTable_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    incidentTable_->verticalHeader()->hide();
+    incidentTable_->horizontalHeader()->setSectionResizeMode(ScopeColumn, QHeaderView::Stretch);
+    layout->addWidget(incidentTable_, 2);
+
+    detailEdit_ = new QPlainTextEdit();
+    detailEdit_->setReadOnly(true);
+    detailEdit_->setPlaceholderText("Select an incident to see its details and stack sample");
+    layout->addWidget(detailEdit_, 1);
+
+    clearButton_ = new QPushButton("Clear");
+    copyButton_ = new QPushButton("Copy All");
+    closeButton_ = new QPushButton("Close");
+    for (QPushButton* button : {clearButton_, copyButton_, closeButton_}) {
+        button->setMinimumHeight(45);
+        button->setMinimumWidth(120);
+    }
+
+    QHBoxLayout* buttonLayout = new QHBoxLayout();
+    buttonLayout->addWidget(clearButton_);
+    buttonLayout->addWidget(copyButton_);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(closeButton_);
+    layout->addLayout(buttonLayout);
+}
+
+void StallDiagnosticsDialog::connectSignals()
+{
+    connect(&StallMonitor::instance(), &StallMonitor::incidentRecorded,
+            this, &StallDiagnosticsDialog::onIncidentRecorded);
+    connect(incidentTable_, &QTableWidget::itemSelectionChanged,
+            this, &StallDiagnosticsDialog::onSelectionChanged);
+    connect(monitorCheckBox_, &QCheckBox::toggled, this, &StallDiagnosticsDialog::onMonitorToggled);
+    connect(stackCheckBox_, &QCheckBox::toggled, this, &StallDiagnosticsDialog::onStackSamplingToggled);
+    connect(thresholdSpinBox_, QOverload<int>::of(&QSpinBox::valueChanged),
+            this, &StallDiagnosticsDialog::onThresholdChanged);
+    connect(clearButton_, &QPushButton::clicked, this, &StallDiagnosticsDialog::onClearClicked);
+    connect(copyButton_, &QPushButton::clicked, this, &StallDiagnosticsDialog::onCopyClicked);
+    connect(closeButton_, &QPushButton::clicked, this, &StallDiagnosticsDialog::close);
+}
+
+void StallDiagnosticsDialog::reload()
+{
+    incidents_ = StallMonitor::instance().getIncidents();
+
+    incidentTable_->setRowCount(0);
+    for (const StallIncident& incident : std::as_const(incidents_)) {
+        appendRow(incident);
+    }
+    detailEdit_->clear();
+    updateStatus();
+}
+
+void StallDiagnosticsDialog::appendRow(const StallIncident& incident)
+{
+    const int row = incidentTable_->rowCount();
+    incidentTable_->insertRow(row);
+    incidentTable_->setItem(row, TimeColumn, new QTableWidgetItem(incident.when.toString("hh:mm:ss.zzz")));
+    incidentTable_->setItem(row, DurationColumn, new QTableWidgetItem(QString("%1 ms").arg(incident.durationMs)));
+    incidentTable_->setItem(row, ReceiverColumn, new QTableWidgetItem(incident.receiver));
+    incidentTable_->setItem(row, EventColumn, new QTableWidgetItem(incident.eventType));
+    incidentTable_->setItem(row, ScopeColumn, new QTableWidgetItem(incident.scopes.join(" < ")));
+}
+
+void StallDiagnosticsDialog::updateStatus()
+{
+    StallMonitor& monitor = StallMonitor::instance();
+    QString status;
+    if (monitor.isRunning()) {
+        status = QString("Monitoring: %1 incidents over %2 ms (most recent %3 kept)")
+                 .arg(incidents_.size())
+                 .arg(monitor.getThresholdMs())
+                 .arg(StallMonitor::MAX_INCIDENTS);
+    } else {
+        status = "Monitor is off. Start it here or launch with --diagnostics.";
+    }
+
+    EmergencyPanelOverlay* overlay = EmergencyOverlayService::instance().overlay();
+    if (overlay && overlay->worstOpenMs() > 0) {
+        status += QString("\nEmergency overlay opens: last %1 ms, worst %2 ms")
+                  .arg(overlay->lastOpenMs(), 0, 'f', 1)
+                  .arg(overlay->worstOpenMs(), 0, 'f', 1);
+    }
+    statusLabel_->setText(status);
+}
+
+void StallDiagnosticsDialog::onIncidentRecorded(const StallIncident& incident)
+{
+    // The buffer only keeps the most recent incidents; mirror that here
+    if (incidents_.size() >= StallMonitor::MAX_INCIDENTS) {
+        incidents_.removeFirst();
+        incidentTable_->removeRow(0);
+    }
+    incidents_.append(incident);
+    appendRow(incident);
+    updateStatus();
+}
+
+void StallDiagnosticsDialog::onSelectionChanged()
+{
+    const int row = incidentTable_->currentRow();
+    if (row < 0 || row >= incidents_.size()) {
+        detailEdit_->clear();
+        return;
+    }
+    detailEdit_->setPlainText(formatIncident(incidents_.at(row)));
+}
+
+void StallDiagnosticsDialog::onMonitorToggled(bool enabled)
+{
+    StallMonitor& monitor = StallMonitor::instance();
+    if (enabled) {
+        monitor.start();
+    } else {
+        monitor.stop();
+        stackCheckBox_->setChecked(false);
+    }
+    ConfigManager::instance().saveStallMonitorEnabled(enabled);
+
+    stackCheckBox_->setEnabled(enabled && StallMonitor::isStackSamplingSupported());
+    updateStatus();
+}
+
+void StallDiagnosticsDialog::onStackSamplingToggled(bool enabled)
+{
+    StallMonitor::instance().setStackSamplingEnabled(enabled);
+}
+
+void StallDiagnosticsDialog::onThresholdChanged(int thresholdMs)
+{
+    // The watchdog interval is fixed when it starts; restart to pick up the change
+    StallMonitor& monitor = StallMonitor::instance();
+    const bool running = monitor.isRunning();
+    const bool sampling = monitor.isStackSamplingEnabled();
+    if (running) {
+        monitor.stop();
+    }
+    monitor.setThresholdMs(thresholdMs);
+    ConfigManager::instance().saveStallThresholdMs(thresholdMs);
+    if (running) {
+        monitor.start();
+        monitor.setStackSamplingEnabled(sampling);
+    }
+    updateStatus();
+}
+
+void StallDiagnosticsDialog::onClearClicked()
+{
+    StallMonitor::instance().clearIncidents();
+    reload();
+}
+
+void StallDiagnosticsDialog::onCopyClicked()
+{
+    QStringList report;
+    for (const StallIncident& incident : std::as_const(incidents_)) {
+        report << formatIncident(incident);
+    }
+    QGuiApplication::clipboard()->setText(report.join("\n\n"));
+}
+
+QString StallDiagnosticsDialog::formatIncident(const StallIncident& incident)
+{
+    QStringList lines;
+    lines << QString("%1  %2 ms  %3  %4")
+             .arg(incident.when.toString("yyyy-MM-dd hh:mm:ss.zzz"))
+             .arg(incident.durationMs)
+             .arg(incident.receiver, incident.eventType);
+    for (const QString& scope : incident.scopes) {
+        lines << "  in " + scope;
+    }
+    if (!incident.stack.isEmpty()) {
+        lines << "  stack:";
+        for (const QString& frame : incident.stack) {
+            lines << "    " + frame;
+        }
+    }
+    return lines.join("\n");
+}
@@ -0,0 +1,51 @@
+#ifndef STALLDIAGNOSTICSDIALOG_H
+#define STALLDIAGNOSTICSDIALOG_H
+
+#include <QDialog>
+#include <QTableWidget>
+#include <QPlainTextEdit>
+#include <QCheckBox>
+#include <QSpinBox>
+#include <QLabel>
+#include <QPushButton>
+#include "core/StallMonitor.h"
+
+// Lists recent event loop stalls recorded by StallMonitor
+class StallDiagnosticsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit StallDiagnosticsDialog(QWidget* parent = nullptr);
+
+private slots:
+    void onIncidentRecorded(const StallIncident& incident);
+    void onSelectionChanged();
+    void onMonitorToggled(bool enabled);
+    void onStackSamplingToggled(bool enabled);
+    void onThresholdChanged(int thresholdMs);
+    void onClearClicked();
+    void onCopyClicked();
+
+private:
+    QLabel* statusLabel_;
+    QCheckBox* monitorCheckBox_;
+    QCheckBox* stackCheckBox_;
+    QSpinBox* thresholdSpinBox_;
+    QTableWidget* incidentTable_;
+    QPlainTextEdit* detailEdit_;
+    QPushButton* clearButton_;
+    QPushButton* copyButton_;
+    QPushButton* closeButton_;
+
+    QList<StallIncident> incidents_;
+
+    void setupUI();
+    void connectSignals();
+    void reload();
+    void appendRow(const StallIncident& incident);
+    void updateStatus();
+    static QString formatIncident(const StallIncident& incident);
+};
+
+#endif // STALLDIAGNOSTICSDIALOG_H
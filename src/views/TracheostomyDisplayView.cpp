@@ -45,9 +45,5 @@ void TracheostomyDisplayView::updateDisplay()
     // Update tracheostomy-specific fields
     trachIndicationLabel_->setText(currentCase_.getTrachIndication());
 
-    SuctionInfo suction = currentCase_.getSuction();
-    QString suctionText = QString("Suction Catheter: %1 Fr\nSuction Depth: %2 cm")
-                          .arg(suction.size)
-                          .arg(suction.depth);
-    suctionInfoLabel_->setText(suctionText);
+    suctionInfoLabel_->setText(formatSuctionInfo(currentCase_.getSuction()));
 }
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include "WallDisplayView.h"
+#include "DisplayCardRenderer.h"
+#include "core/CaseManager.h"
+#include <QPainter>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QDir>
+#include <QFileInfo>
+#include <QtConcurrent>
+#include <algorithm>
+
+namespace {
+
+const int CELL_MARGIN = 8;
+
+struct GridLayout {
+    int columns = 1;
+    int rows = 1;
+    QSize cardSize;
+};
+
+// Picks the column count that gives the largest cards at the card aspect ratio
+GridLayout computeGrid(int count, const QSize& area)
+{
+    GridLayout grid;
+    if (count <= 0 || area.isEmpty()) {
+        return grid;
+    }
+
+    const QSizeF card = DisplayCardRenderer::cardSize();
+    qreal bestScale = -1.0;
+    for (int columns = 1; columns <= count; ++columns) {
+        const int rows = (count + columns - 1) / columns;
+        const qreal scale = qMin(area.width() / qreal(columns) / card.width(),
+                                 area.height() / qreal(rows) / card.height());
+        if (scale > bestScale) {
+            bestScale = scale;
+            grid.columns = columns;
+            grid.rows = rows;
+        }
+    }
+
+    grid.cardSize = QSize(qMax(1, area.width() / grid.columns - 2 * CELL_MARGIN),
+                          qMax(1, area.height() / grid.rows - 2 * CELL_MARGIN));
+    return grid;
+}
+
+QStringList listCaseFiles(const QStringList& directories)
+{
+    QStringList filePaths;
+    for (const QString& directory : directories) {
+        QDir dir(directory);
+        const QStringList files = dir.entryList(QStringList() << "*.json", QDir::Files);
+        for (const QString& file : files) {
+            filePaths << dir.absoluteFilePath(file);
+        }
+    }
+    return filePaths;
+}
+
+// Runs on a worker thread: lists the cases, then reads and renders only the
+// files that are new, changed, or were rendered at a different size
+WallDisplayView::RenderResult renderChangedCards(int generation, const QStringList& directories,
+                                                 const QHash<QString, QDateTime>& rendered,
+                                                 const QSize& area, qreal devicePixelRatio)
+{
+    WallDisplayView::RenderResult result;
+    result.generation = generation;
+    result.filePaths = listCaseFiles(directories);
+
+    const GridLayout grid = computeGrid(result.filePaths.size(), area);
+    result.columns = grid.columns;
+    result.rows = grid.rows;
+    result.cardSize = grid.cardSize;
+
+    for (const QString& filePath : std::as_const(result.filePaths)) {
+        const QDateTime modified = QFileInfo(filePath).lastModified();
+        auto known = rendered.constFind(filePath);
+        if (known != rendered.cend() && known.value() == modified) {
+            continue;
+        }
+
+        // Unreadable files (e.g. mid-save) are skipped and retried on the next change
+        Case displayCase;
+        if (!CaseManager::readCaseFile(filePath, displayCase)) {
+            continue;
+        }
+
+        WallDisplayView::Card card;
+        card.filePath = filePath;
+        card.modified = modified;
+        card.sortKey = displayCase.getPatient().firstName.toLower();
+        card.image = DisplayCardRenderer::render(displayCase, grid.cardSize, devicePixelRatio);
+        result.renderedCards.append(card);
+    }
+
+    return result;
+}
+
+} // namespace
+
+WallDisplayView::WallDisplayView(CaseManager* caseManager, QWidget* parent)
+    : QWidget(parent)
+    , caseManager_(caseManager)
+    , renderWatcher_(nullptr)
+    , columns_(1)
+    , rows_(1)
+    , generation_(0)
+    , active_(false)
+    , refreshPending_(false)
+{
+    setFocusPolicy(Qt::StrongFocus);
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    renderWatcher_ = new QFutureWatcher<RenderResult>(this);
+    connect(renderWatcher_, &QFutureWatcher<RenderResult>::finished, this, &WallDisplayView::onRenderFinished);
+    connect(caseManager_, &CaseManager::casesChanged, this, &WallDisplayView::onCasesChanged);
+}
+
+WallDisplayView::~WallDisplayView()
+{
+    // The render job only touches its own copies, but must not outlive the watcher
+    renderWatcher_->waitForFinished();
+}
+
+void WallDisplayView::start()
+{
+    active_ = true;
+    refresh();
+}
+
+void WallDisplayView::stop()
+{
+    active_ = false;
+    refreshPending_ = false;
+    ++generation_;
+
+    for (const QString& filePath : std::as_const(order_)) {
+        caseManager_->unwatchCaseFile(filePath);
+    }
+    cards_.clear();
+    order_.clear();
+}
+
+void WallDisplayView::refresh()
+{
+    if (!active_) return;
+
+    if (renderWatcher_->isRunning()) {
+        // Runs as soon as the running job's result is on screen
+        refreshPending_ = true;
+        return;
+    }
+    refreshPending_ = false;
+    ++generation_;
+
+    // Cards rendered at another size count as changed
+    QHash<QString, QDateTime> rendered;
+    for (auto it = cards_.cbegin(); it != cards_.cend(); ++it) {
+        if (it.value().image.size() == cardSize_ * devicePixelRatioF()) {
+            rendered.insert(it.key(), it.value().modified);
+        }
+    }
+
+    const QStringList directories = {
+        caseManager_->getCaseDirectory(CaseType::Tracheostomy),
+        caseManager_->getCaseDirectory(CaseType::NewTracheostomy)
+    };
+
+    renderWatcher_->setFuture(QtConcurrent::run(renderChangedCards, generation_, directories,
+                                                rendered, size(), devicePixelRatioF()));
+}
+
+void WallDisplayView::onRenderFinished()
+{
+    const RenderResult result = renderWatcher_->result();
+
+    // Still newer than what is on screen, even if a refresh came in meanwhile;
+    // that refresh renders whatever changed since
+    if (active_ && result.generation == generation_) {
+        applyResult(result);
+    }
+
+    if (refreshPending_) {
+        refresh();
+    }
+}
+
+void WallDisplayView::applyResult(const RenderResult& result)
+{
+    QHash<QString, Card> cards;
+    for (const Card& card : result.renderedCards) {
+        cards.insert(card.filePath, card);
+    }
+
+    // Unchanged cards carry over; files that could not be read keep their last card
+    for (const QString& filePath : result.filePaths) {
+        if (!cards.contains(filePath) && cards_.contains(filePath)) {
+            cards.insert(filePath, cards_.value(filePath));
+        }
+    }
+
+    // Keep a watch on each shown file so edits in place are noticed
+    for (auto it = cards.cbegin(); it != cards.cend(); ++it) {
+        if (!cards_.contains(it.key())) {
+            caseManager_->watchCaseFile(it.key());
+        }
+    }
+    for (auto it = cards_.cbegin(); it != cards_.cend(); ++it) {
+        if (!cards.contains(it.key())) {
+            caseManager_->unwatchCaseFile(it.key());
+        }
+    }
+
+    QStringList order = cards.keys();
+    std::sort(order.begin(), order.end(), [&cards](const QString& a, const QString& b) {
+        const QString& keyA = cards[a].sortKey;
+        const QString& keyB = cards[b].sortKey;
+        return keyA != keyB ? keyA < keyB : a < b;
+    });
+
+    cards_ = cards;
+    order_ = order;
+    columns_ = result.columns;
+    rows_ = result.rows;
+    cardSize_ = result.cardSize;
+    update();
+}
+
+QRect WallDisplayView::cellRect(int index) const
+{
+    const int cellWidth = width() / qMax(1, columns_);
+    const int cellHeight = height() / qMax(1, rows_);
+    return QRect((index % columns_) * cellWidth, (index / columns_) * cellHeight, cellWidth, cellHeight)
+           .adjusted(CELL_MARGIN, CELL_MARGIN, -CELL_MARGIN, -CELL_MARGIN);
+}
+
+void WallDisplayView::paintEvent(QPaintEvent* event)
+{
+    QPainter painter(this);
+    painter.fillRect(event->rect(), QColor("#263238"));
+
+    if (order_.isEmpty()) {
+        QFont font = painter.font();
+        font.setPixelSize(36);
+        painter.setFont(font);
+        painter.setPen(Qt::white);
+        painter.drawText(rect(), Qt::AlignCenter,
+                         renderWatcher_->isRunning() ? "Loading cases..." : "No active tracheostomy cases");
+        return;
+    }
+
+    // Old images are scaled into place until their re-render arrives
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    for (int i = 0; i < order_.size(); ++i) {
+        const QRect target = cellRect(i);
+        if (!target.intersects(event->rect())) continue;
+        painter.drawImage(target, cards_[order_.at(i)].image);
+    }
+}
+
+void WallDisplayView::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+    refresh();
+}
+
+void WallDisplayView::keyPressEvent(QKeyEvent* event)
+{
+    if (event->key() == Qt::Key_Escape) {
+        emit exitRequested();
+        event->accept();
+        return;
+    }
+
+    QWidget::keyPressEvent(event);
+}
+
+void WallDisplayView::mouseDoubleClickEvent(QMouseEvent* event)
+{
+    Q_UNUSED(event)
+    emit exitRequested();
+}
+
+void WallDisplayView::onCasesChanged()
+{
+    refresh();
+}
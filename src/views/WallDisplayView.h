@@ -0,0 +1,77 @@
+#ifndef WALLDISPLAYVIEW_H
+#define WALLDISPLAYVIEW_H
+
+#include <QWidget>
+#include <QImage>
+#include <QDateTime>
+#include <QHash>
+#include <QStringList>
+#include <QFutureWatcher>
+
+class CaseManager;
+
+// Nurses' station view: the display card of every active tracheostomy case in
+// one grid. Cards are rendered to images on a worker thread and painted as
+// plain images; only files whose modification time changed are rendered again.
+class WallDisplayView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    struct Card {
+        QString filePath;
+        QDateTime modified;
+        QString sortKey;
+        QImage image;
+    };
+
+    struct RenderResult {
+        int generation = 0;
+        int columns = 1;
+        int rows = 1;
+        QSize cardSize;
+        QStringList filePaths;
+        QList<Card> renderedCards;
+    };
+
+    explicit WallDisplayView(CaseManager* caseManager, QWidget* parent = nullptr);
+    ~WallDisplayView();
+
+    void start();
+    void stop();
+
+signals:
+    void exitRequested();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+
+private slots:
+    void onCasesChanged();
+    void onRenderFinished();
+
+private:
+    CaseManager* caseManager_;
+    QFutureWatcher<RenderResult>* renderWatcher_;
+
+    QHash<QString, Card> cards_;
+    QStringList order_;
+    int columns_;
+    int rows_;
+    QSize cardSize_;
+
+    // Bumped when a render starts and when the view stops, so only a result
+    // that stop() overtook is dropped; a newer refresh never discards it
+    int generation_;
+    bool active_;
+    bool refreshPending_;
+
+    void refresh();
+    void applyResult(const RenderResult& result);
+    QRect cellRect(int index) const;
+};
+
+#endif // WALLDISPLAYVIEW_H
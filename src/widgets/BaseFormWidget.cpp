@@ -1,6 +1,11 @@
 #include "BaseFormWidget.h"
 #include "utils/StyleManager.h"
+#include "core/StallMonitor.h"
+#include "utils/CasePrintLayout.h"
+#include "utils/SATrachTube.h"
+#include "widgets/EmergencyOverlayService.h"
 #include <QHeaderView>
+#include <QComboBox>
 #include <QMessageBox>
 #include <QPrinter>
 #include <QPrintDialog>
@@ -12,13 +17,17 @@
 #include <QPixmap>
 #include <QGuiApplication>
 #include <QScreen>
+#include <QShowEvent>
+#include <QHideEvent>
+#include <QtConcurrent>
 
 BaseFormWidget::BaseFormWidget(CaseType caseType, QWidget* parent)
     : QWidget(parent)
     , caseType_(caseType)
+    , dirtyFields_(0)
     , frozen_(false)
     , justSaved_(true)
-    , loading_(false)
+    , updateDepth_(0)
     , screenSize_(QGuiApplication::primaryScreen()->availableSize())
     , scrollArea_(nullptr)
     , contentWidget_(nullptr)
@@ -26,6 +35,10 @@ BaseFormWidget::BaseFormWidget(CaseType caseType, QWidget* parent)
     , contentLayout_(nullptr)
     , rightLayout_(nullptr)
     , formFieldsLayout_(nullptr)
+    , section_(&FormSections::forCaseType(caseType))
+    , sectionGroup_(nullptr)
+    , headerCard_(nullptr)
+    , accentBar_(nullptr)
     , headerLabel_(nullptr)
     , logoLabel_(nullptr)
     , patientInfoWidget_(nullptr)
@@ -34,20 +47,25 @@ BaseFormWidget::BaseFormWidget(CaseType caseType, QWidget* parent)
     , removeRowButton_(nullptr)
     , moveUpButton_(nullptr)
     , moveDownButton_(nullptr)
-    , emergencyPanelOverlay_(nullptr)
     , emergencyButton_(nullptr)
     , sidePanelGroup_(nullptr)
     , suctionSizeSpinBox_(nullptr)
     , suctionDepthEdit_(nullptr)
+    , suctionRecommendButton_(nullptr)
     , specialCommentsEdit_(nullptr)
+    , suctionSizeOverridden_(false)
+    , suctionDepthOverridden_(false)
+    , applyingSuctionRecommendation_(false)
     , freezeButton_(nullptr)
     , saveButton_(nullptr)
     , printButton_(nullptr)
+    , displayButton_(nullptr)
     , backButton_(nullptr)
+    , validator_(nullptr)
 {
-    currentCase_ = Case();  // Use default constructor to generate UUID
-    currentCase_.setCaseType(caseType);
+    currentCase_ = Case::createNew(caseType);
     setupUI();
+    setupValidation();
     connectSignals();
     updateStyles();
 }
@@ -76,20 +94,17 @@ void BaseFormWidget::setupUI()
     
     setupHeader();
 
-    // Get case type color for branding
-    QColor caseColor = StyleManager::instance().getFormColour(caseType_);
-
-    // Modern header card with colored accent
-    QWidget* headerWidget = new QWidget();
-    QVBoxLayout* headerMainLayout = new QVBoxLayout(headerWidget);
+    // Modern header card with colored accent; the case type's colour is
+    // applied by applyCaseTypeStyle()
+    headerCard_ = new QWidget();
+    QVBoxLayout* headerMainLayout = new QVBoxLayout(headerCard_);
     headerMainLayout->setContentsMargins(0, 0, 0, 0);
     headerMainLayout->setSpacing(0);
 
     // Colored accent bar at top
-    QWidget* accentBar = new QWidget();
-    accentBar->setFixedHeight(6);
-    accentBar->setStyleSheet(QString("background-color: %1; border-top-left-radius: 12px; border-top-right-radius: 12px;").arg(caseColor.name()));
-    headerMainLayout->addWidget(accentBar);
+    accentBar_ = new QWidget();
+    accentBar_->setFixedHeight(6);
+    headerMainLayout->addWidget(accentBar_);
 
     // Header content
     QWidget* headerContent = new QWidget();
@@ -112,22 +127,13 @@ void BaseFormWidget::setupUI()
     headerLayout->addWidget(patientInfoWidget_);
 
     // Add form title with case type color
-    headerLabel_->setStyleSheet(QString("font-size: 32px; font-weight: bold; color: %1;").arg(caseColor.name()));
     headerLayout->addWidget(headerLabel_, 1);
 
     headerMainLayout->addWidget(headerContent);
 
-    // Apply outer border to entire header widget
-    headerWidget->setStyleSheet(QString(
-        "QWidget#headerCard {"
-        "   border: 1px solid #E0E0E0;"
-        "   border-radius: 12px;"
-        "   border-left: 4px solid %1;"
-        "}"
-    ).arg(caseColor.name()));
-    headerWidget->setObjectName("headerCard");
+    headerCard_->setObjectName("headerCard");
 
-    contentLayout_->addWidget(headerWidget);
+    contentLayout_->addWidget(headerCard_);
     
     // Create two main columns layout
     QHBoxLayout* mainContentLayout = new QHBoxLayout();
@@ -143,11 +149,10 @@ void BaseFormWidget::setupUI()
     QWidget* formFieldsWidget = new QWidget();
     formFieldsLayout_ = new QVBoxLayout(formFieldsWidget);
     formFieldsLayout_->setContentsMargins(0, 10, 0, 0);
+    // Stretch pushes the section to the top
+    formFieldsLayout_->addStretch();
     leftColumnLayout->addWidget(formFieldsWidget);
 
-    // Create emergency panel overlay (initially hidden)
-    emergencyPanelOverlay_ = new EmergencyPanelOverlay(this);
-
     leftColumnLayout->addStretch();
 
     // COLUMN 2: Tube Specification Widget
@@ -210,32 +215,99 @@ void BaseFormWidget::setupUI()
     bottomButtonLayout->addStretch();
     bottomButtonLayout->addWidget(saveButton_);
     bottomButtonLayout->addWidget(printButton_);
+    bottomButtonLayout->addWidget(displayButton_);
     bottomButtonLayout->addWidget(backButton_);
 
     contentLayout_->addWidget(buttonBarWidget);
     
     // Connect emergency button signal now that it's created
-    connect(emergencyButton_, &QPushButton::clicked, this, [this]() {
-        emergencyPanelOverlay_->showOverlay();
-    });
+    connect(emergencyButton_, &QPushButton::clicked, this, &BaseFormWidget::showEmergencyOverlay);
     
     scrollArea_->setWidget(contentWidget_);
     mainLayout_->addWidget(scrollArea_);
     
     setLayout(mainLayout_);
+
+    setupSection();
+    applyCaseTypeStyle();
 }
 
-void BaseFormWidget::finishSetup()
+void BaseFormWidget::setupSection()
 {
-    // Now setup form-specific fields - they will be added to formFieldsLayout_
-    setupFormSpecificFields();
-    
-    // Add stretch to form fields layout to push content to top
-    if (formFieldsLayout_) {
-        formFieldsLayout_->addStretch();
+    // Only the previous case type's group goes; the rest of the form is kept
+    delete sectionGroup_;
+    sectionEdits_.clear();
+
+    sectionGroup_ = new QGroupBox(section_->groupTitle);
+    sectionGroup_->setFont(StyleManager::instance().getGroupBoxFont());
+    QVBoxLayout* groupLayout = new QVBoxLayout(sectionGroup_);
+    groupLayout->setSpacing(5);
+
+    // Vertical layout: label above input (consistent with TubeSpecificationWidget)
+    const int fieldHeight = screenSize_.height() * 0.04; // 4% of screen height
+
+    for (int i = 0; i < section_->fieldCount; ++i) {
+        const FormSectionField& sectionField = section_->fields[i];
+
+        QLabel* label = new QLabel(sectionField.label);
+        label->setFont(StyleManager::instance().getFormLabelFont());
+        groupLayout->addWidget(label);
+
+        QLineEdit* edit = new QLineEdit();
+        edit->setPlaceholderText(sectionField.placeholder);
+        edit->setMinimumHeight(fieldHeight);
+        edit->setFont(StyleManager::instance().getFormInputFont());
+        groupLayout->addWidget(edit);
+        sectionEdits_.append(edit);
+
+        const quint32 field = sectionField.field;
+        connect(edit, &QLineEdit::textChanged, this, [this, field]() { markFieldDirty(field); });
+    }
+
+    formFieldsLayout_->insertWidget(0, sectionGroup_);
+}
+
+void BaseFormWidget::applyCaseTypeStyle()
+{
+    QColor caseColor = StyleManager::instance().getFormColour(caseType_);
+
+    accentBar_->setStyleSheet(QString("background-color: %1; border-top-left-radius: 12px; border-top-right-radius: 12px;").arg(caseColor.name()));
+    headerLabel_->setStyleSheet(QString("font-size: 32px; font-weight: bold; color: %1;").arg(caseColor.name()));
+    headerLabel_->setText(section_->formTitle);
+
+    // Apply outer border to entire header widget
+    headerCard_->setStyleSheet(QString(
+        "QWidget#headerCard {"
+        "   border: 1px solid #E0E0E0;"
+        "   border-radius: 12px;"
+        "   border-left: 4px solid %1;"
+        "}"
+    ).arg(caseColor.name()));
+}
+
+void BaseFormWidget::applyCaseType(CaseType caseType)
+{
+    if (caseType == caseType_) return;
+
+    StallMonitor::Scope scope("BaseFormWidget::applyCaseType");
+    caseType_ = caseType;
+    section_ = &FormSections::forCaseType(caseType);
+
+    setupSection();
+    applyCaseTypeStyle();
+    updateStyles();
+
+    if (EmergencyOverlayService::instance().isBoundTo(this)) {
+        bindEmergencyOverlay();
     }
 }
 
+void BaseFormWidget::setCaseType(CaseType caseType)
+{
+    applyCaseType(caseType);
+    clear();
+}
+
 void BaseFormWidget::setupHeader()
 {
     // Create logo label - smaller since it's now beside the title
@@ -258,24 +330,6 @@ void BaseFormWidget::setupHeader()
     headerLabel_->setObjectName("headerLabel");
     headerLabel_->setAlignment(Qt::AlignCenter);
     headerLabel_->setMinimumHeight(60);
-    
-    QString formTitle;
-    switch (caseType_) {
-    case CaseType::Tracheostomy:
-        formTitle = "TRACHEOSTOMY FORM";
-        break;
-    case CaseType::NewTracheostomy:
-        formTitle = "NEW TRACHEOSTOMY FORM";
-        break;
-    case CaseType::DifficultAirway:
-        formTitle = "DIFFICULT AIRWAY FORM";
-        break;
-    case CaseType::LTR:
-        formTitle = "LARYNGOTRACHEAL RECONSTRUCTION (LTR) FORM";
-        break;
-    }
-    
-    headerLabel_->setText(formTitle);
 }
 
 
@@ -368,11 +422,32 @@ void BaseFormWidget::setupSidePanel()
     );
     layout->addWidget(suctionDepthEdit_);
 
+    // Only shown once a value has been typed over the recommendation
+    suctionRecommendButton_ = new QPushButton();
+    suctionRecommendButton_->setMinimumHeight(40);
+    suctionRecommendButton_->setCursor(Qt::PointingHandCursor);
+    suctionRecommendButton_->setStyleSheet(
+        "QPushButton {"
+        "   background-color: #ECEFF1;"
+        "   color: #1976D2;"
+        "   border: 1px solid #B0BEC5;"
+        "   border-radius: 6px;"
+        "   padding: 6px 12px;"
+        "   font-size: 24px;"
+        "}"
+        "QPushButton:hover {"
+        "   background-color: #E3F2FD;"
+        "}"
+    );
+    suctionRecommendButton_->setVisible(false);
+    layout->addWidget(suctionRecommendButton_);
+
     QLabel* commentsLabel = new QLabel("Special Comments:");
     commentsLabel->setStyleSheet("color: #546E7A; font-size: 32px; font-weight: normal;");
     layout->addWidget(commentsLabel);
 
     specialCommentsEdit_ = new QTextEdit();
+    specialCommentsEdit_->setObjectName("specialCommentsEdit");
     specialCommentsEdit_->setMinimumHeight(120);
     specialCommentsEdit_->setMaximumHeight(180);
     specialCommentsEdit_->setStyleSheet(
@@ -495,11 +570,13 @@ void BaseFormWidget::setupActionButtons()
     freezeButton_ = createButton("Freeze", "#607D8B", "#546E7A", true);
     saveButton_ = createButton("Save Case", "#1976D2", "#1565C0");
     printButton_ = createButton("Print", "#78909C", "#607D8B");
+    displayButton_ = createButton("Display", "#78909C", "#607D8B");
     backButton_ = createButton("Back", "#90A4AE", "#78909C");
 
     connect(freezeButton_, &QPushButton::toggled, this, &BaseFormWidget::onFreezeClicked);
     connect(saveButton_, &QPushButton::clicked, this, &BaseFormWidget::onSaveClicked);
     connect(printButton_, &QPushButton::clicked, this, &BaseFormWidget::onPrintClicked);
+    connect(displayButton_, &QPushButton::clicked, this, &BaseFormWidget::onDisplayClicked);
     connect(backButton_, &QPushButton::clicked, this, &BaseFormWidget::onBackClicked);
 }
 
@@ -507,12 +584,34 @@ void BaseFormWidget::connectSignals()
 {
     connect(patientInfoWidget_, &PatientInfoWidget::patientInfoChanged, this, &BaseFormWidget::onPatientInfoChanged);
     // Emergency button connection will be added after setupUI is complete
-    connect(emergencyPanelOverlay_, &EmergencyPanelOverlay::scenarioSelected, this, &BaseFormWidget::onEmergencyScenarioSelected);
+    connect(&EmergencyOverlayService::instance(), &EmergencyOverlayService::scenarioSelected, this,
+            [this](QObject* owner, const QString& scenario) {
+        if (owner == this) {
+            onEmergencyScenarioSelected(scenario);
+        }
+    });
     connect(suctionSizeSpinBox_, QOverload<int>::of(&QSpinBox::valueChanged), this, &BaseFormWidget::onSuctionSizeChanged);
-    connect(tubeSpecWidget_, &TubeSpecificationWidget::specificationChanged, this, &BaseFormWidget::onFormFieldChanged);
+    connect(tubeSpecWidget_, &TubeSpecificationWidget::specificationChanged, this, [this]() {
+        markFieldDirty(TubeSpecField);
+        applySuctionRecommendation();
+        updateOverlayParameters();
+    });
 
-    connect(suctionDepthEdit_, &QLineEdit::textChanged, this, &BaseFormWidget::onFormFieldChanged);
-    connect(specialCommentsEdit_, &QTextEdit::textChanged, this, &BaseFormWidget::onFormFieldChanged);
+    connect(suctionDepthEdit_, &QLineEdit::textChanged, this, [this]() {
+        if (!applyingSuctionRecommendation_ && !suctionDepthOverridden_) {
+            suctionDepthOverridden_ = true;
+            updateSuctionRecommendButton();
+        }
+        updateOverlayParameters();
+        markFieldDirty(SuctionField);
+    });
+    connect(suctionRecommendButton_, &QPushButton::clicked, this, [this]() {
+        suctionSizeOverridden_ = false;
+        suctionDepthOverridden_ = false;
+        applySuctionRecommendation();
+        markFieldDirty(SuctionField);
+    });
+    connect(specialCommentsEdit_, &QTextEdit::textChanged, this, [this]() { markFieldDirty(SpecialCommentsField); });
 }
 
 void BaseFormWidget::updateStyles()
@@ -522,46 +621,161 @@ void BaseFormWidget::updateStyles()
 
 void BaseFormWidget::setCase(const Case& case_)
 {
+    StallMonitor::Scope scope("BaseFormWidget::setCase");
+    applyCaseType(case_.getCaseType());
     currentCase_ = case_;
     loadFormData();
     justSaved_ = true; // Loading a case means it's saved
 }
 
+void BaseFormWidget::beginUpdate()
+{
+    if (updateDepth_++ > 0) return;
+
+    // Block every field that feeds formChanged, plus the form itself
+    updateBlockers_.emplace_back(this);
+    const QList<QWidget*> children = findChildren<QWidget*>();
+    for (QWidget* child : children) {
+        if (qobject_cast<QLineEdit*>(child) || qobject_cast<QTextEdit*>(child)
+            || qobject_cast<QAbstractSpinBox*>(child) || qobject_cast<QComboBox*>(child)
+            || qobject_cast<PatientInfoWidget*>(child) || qobject_cast<TubeSpecificationWidget*>(child)) {
+            updateBlockers_.emplace_back(child);
+        }
+    }
+
+    setUpdatesEnabled(false);
+}
+
+void BaseFormWidget::endUpdate(bool markModified)
+{
+    if (updateDepth_ == 0 || --updateDepth_ > 0) return;
+
+    updateBlockers_.clear();
+
+    // Derived state normally pushed by the blocked signals
+    updateOverlayParameters();
+    updateEmergencyAdvice();
+
+    // Re-enabling updates schedules a single repaint of the whole form
+    setUpdatesEnabled(true);
+
+    if (markModified) {
+        markFieldDirty(AllFields);
+    } else {
+        // Freshly loaded values are checked without flagging them inline
+        validator_->reset();
+    }
+}
+
 Case BaseFormWidget::getCase() const
 {
-    Case case_ = currentCase_;
-    
-    // Update case with current tube specification
-    SpecificationTableRow spec = tubeSpecWidget_->getSpecification();
-    QList<SpecificationTableRow> specs;
-    if (!spec.size.isEmpty()) {
-        SpecificationTableRow row;
-        row.makeModel = spec.makeModel;
-        row.size = spec.size;
-        row.type = spec.type;
-        row.cuff = spec.cuff;
-        row.innerDiameter = spec.innerDiameter;
-        row.outerDiameter = spec.outerDiameter;
-        row.length = spec.length;
-        row.reorderNumber = spec.reorderNumber;
-        specs.append(row);
+    syncDirtyFields();
+    return currentCase_;
+}
+
+void BaseFormWidget::markSaved(const QString& filePath, const QDateTime& updatedAt)
+{
+    syncDirtyFields();
+    currentCase_.setFilePath(filePath);
+    currentCase_.setUpdatedAt(updatedAt);
+    justSaved_ = true;
+}
+
+void BaseFormWidget::markFieldDirty(quint32 fields)
+{
+    if (isUpdating()) return;
+
+    dirtyFields_ |= fields;
+    validator_->revalidate(fields);
+    justSaved_ = false;
+    currentCase_.setUpdatedAt(QDateTime::currentDateTime());
+    emit formChanged();
+}
+
+void BaseFormWidget::syncDirtyFields() const
+{
+    if (dirtyFields_ == 0) return;
+
+    const quint32 fields = dirtyFields_;
+    dirtyFields_ = 0;
+
+    if (fields & TubeSpecField) {
+        SpecificationTableRow spec = tubeSpecWidget_->getSpecification();
+        QList<SpecificationTableRow> specs;
+        if (spec.hasSize()) {
+            specs.append(spec);
+        }
+        currentCase_.setSpecTable(specs);
+    }
+
+    if (fields & PatientField) {
+        currentCase_.setPatient(patientInfoWidget_->getPatientInfo());
+    }
+
+    if (fields & EmergencyScenarioField) {
+        currentCase_.setEmergencyScenario(emergencyScenario_);
+    }
+
+    if (fields & SuctionField) {
+        SuctionInfo suction;
+        suction.size = suctionSizeSpinBox_->value();
+        suction.depth = suctionDepthEdit_->text();
+        suction.sizeOverridden = suctionSizeOverridden_;
+        suction.depthOverridden = suctionDepthOverridden_;
+        currentCase_.setSuction(suction);
+    }
+
+    if (fields & SpecialCommentsField) {
+        currentCase_.setSpecialComments(specialCommentsEdit_->toPlainText());
+    }
+
+    for (int i = 0; i < sectionEdits_.size(); ++i) {
+        const FormSectionField& sectionField = section_->fields[i];
+        if (fields & sectionField.field) {
+            (currentCase_.*sectionField.set)(sectionEdits_.at(i)->text());
+        }
+    }
+}
+
+void BaseFormWidget::showEmergencyOverlay()
+{
+    if (!EmergencyOverlayService::instance().isBoundTo(this)) {
+        bindEmergencyOverlay();
+    }
+    EmergencyOverlayService::instance().showOverlay(frozen_);
+}
+
+void BaseFormWidget::bindEmergencyOverlay()
+{
+    EmergencyOverlayService::instance().bind(this, caseType_, scenarioParameters(), emergencyScenario_);
+}
+
+ScenarioParameters BaseFormWidget::scenarioParameters() const
+{
+    return ScenarioParameters::fromFields(suctionSizeSpinBox_->value(), suctionDepthEdit_->text(),
+                                          tubeSpecWidget_->manufacturer(), tubeSpecWidget_->typeText(),
+                                          tubeSpecWidget_->sizeText());
+}
+
+void BaseFormWidget::updateOverlayParameters()
+{
+    EmergencyOverlayService::instance().setParameters(this, scenarioParameters());
+}
+
+void BaseFormWidget::showEvent(QShowEvent* event)
+{
+    QWidget::showEvent(event);
+    bindEmergencyOverlay();
+}
+
+void BaseFormWidget::hideEvent(QHideEvent* event)
+{
+    QWidget::hideEvent(event);
+
+    // Minimizing the window does not make another view active
+    if (!event->spontaneous()) {
+        EmergencyOverlayService::instance().release(this);
     }
-    case_.setSpecTable(specs);
-    
-    // Now update all form fields
-    case_.setPatient(patientInfoWidget_->getPatientInfo());
-    case_.setEmergencyScenario(emergencyPanelOverlay_->getSelectedScenario());
-    
-    SuctionInfo suction;
-    suction.size = suctionSizeSpinBox_->value();
-    suction.depth = suctionDepthEdit_->text();
-    case_.setSuction(suction);
-    
-    
-    case_.setSpecialComments(specialCommentsEdit_->toPlainText());
-    case_.setUpdatedAt(QDateTime::currentDateTime());
-    
-    return case_;
 }
 
 void BaseFormWidget::setFrozen(bool frozen)
@@ -569,12 +783,12 @@ void BaseFormWidget::setFrozen(bool frozen)
     frozen_ = frozen;
     
     patientInfoWidget_->setFrozen(frozen);
-    emergencyButton_->setEnabled(!frozen);
     
     tubeSpecWidget_->setReadOnly(frozen);
 
     suctionSizeSpinBox_->setEnabled(!frozen);
     suctionDepthEdit_->setReadOnly(frozen);
+    suctionRecommendButton_->setEnabled(!frozen);
     specialCommentsEdit_->setReadOnly(frozen);
     
     saveButton_->setEnabled(!frozen);
@@ -593,40 +807,28 @@ void BaseFormWidget::setFrozen(bool frozen)
     emit freezeModeToggled(frozen);
 }
 
-bool BaseFormWidget::isFormValid() const
+void BaseFormWidget::setupValidation()
 {
-    return getValidationErrors().isEmpty();
-}
-
-QStringList BaseFormWidget::getValidationErrors() const
-{
-    QStringList errors;
-    
-    PatientInfo patient = patientInfoWidget_->getPatientInfo();
-    if (patient.firstName.isEmpty()) {
-        errors << "Patient first name is required";
-    }
-    
-    if (!tubeSpecWidget_->isValid()) {
-        errors.append(tubeSpecWidget_->getValidationErrors());
-    }
-    
-    return errors;
+    // Rules read the widgets directly, so dirty fields need no sync first
+    validator_ = new FormValidator(this);
+    validator_->setRules({
+        { PatientField, "Patient first name is required",
+          [this]() { return !patientInfoWidget_->firstNameInput()->text().isEmpty(); },
+          patientInfoWidget_->firstNameInput() },
+        { TubeSpecField, "Please select a manufacturer",
+          [this]() { return !tubeSpecWidget_->manufacturer().isEmpty(); },
+          tubeSpecWidget_->manufacturerInput() },
+        { TubeSpecField, "Please select a tube size",
+          [this]() { return !tubeSpecWidget_->sizeText().isEmpty(); },
+          tubeSpecWidget_->sizeInput() }
+    });
 }
 
 void BaseFormWidget::clear()
 {
-    patientInfoWidget_->clear();
-    emergencyPanelOverlay_->setSelectedScenario("");
-    
-    tubeSpecWidget_->clear();
-
-    suctionSizeSpinBox_->setValue(6);
-    suctionDepthEdit_->clear();
-    specialCommentsEdit_->clear();
-    
-    currentCase_ = Case();  // Use default constructor to generate UUID
-    currentCase_.setCaseType(caseType_);
+    // A blank case loaded like any other keeps the widgets and model in step
+    currentCase_ = Case::createNew(caseType_);
+    loadFormData();
     justSaved_ = true; // New empty case is considered "saved"
 }
 
@@ -636,41 +838,42 @@ void BaseFormWidget::clear()
 
 void BaseFormWidget::loadFormData()
 {
-    loading_ = true; // Prevent signals from marking form as modified
+    beginUpdate(); // Prevent signals from marking form as modified
 
     patientInfoWidget_->setPatientInfo(currentCase_.getPatient());
-    emergencyPanelOverlay_->setSelectedScenario(currentCase_.getEmergencyScenario());
+    emergencyScenario_ = currentCase_.getEmergencyScenario();
+    EmergencyOverlayService::instance().setSelectedScenario(this, emergencyScenario_);
 
     updateTableFromCase();
 
     SuctionInfo suction = currentCase_.getSuction();
     suctionSizeSpinBox_->setValue(suction.size);
     suctionDepthEdit_->setText(suction.depth);
+    suctionSizeOverridden_ = suction.sizeOverridden;
+    suctionDepthOverridden_ = suction.depthOverridden;
+    updateSuctionRecommendButton();
 
     specialCommentsEdit_->setPlainText(currentCase_.getSpecialComments());
 
-    loading_ = false; // Re-enable modification tracking
+    for (int i = 0; i < sectionEdits_.size(); ++i) {
+        // Unchanged text skips the relayout setText would cause
+        const QString& value = (currentCase_.*section_->fields[i].get)();
+        if (sectionEdits_.at(i)->text() != value) {
+            sectionEdits_.at(i)->setText(value);
+        }
+    }
+    dirtyFields_ = 0; // Widgets now mirror the edit model
+
+    endUpdate(); // Re-enable modification tracking
 }
 
 void BaseFormWidget::updateTableFromCase()
 {
-    QList<SpecificationTableRow> specs = currentCase_.getSpecTable();
+    const QList<SpecificationTableRow>& specs = currentCase_.getSpecTable();
     
     // Load first specification into the widget (if any)
     if (!specs.isEmpty()) {
-        const SpecificationTableRow& spec = specs.first();
-        
-        SpecificationTableRow tubeSpec;
-        tubeSpec.makeModel = spec.makeModel;
-        tubeSpec.size = spec.size;
-        tubeSpec.type = spec.type;
-        tubeSpec.cuff = spec.cuff;
-        tubeSpec.innerDiameter = spec.innerDiameter;
-        tubeSpec.outerDiameter = spec.outerDiameter;
-        tubeSpec.length = spec.length;
-        tubeSpec.reorderNumber = spec.reorderNumber;
-        
-        tubeSpecWidget_->setSpecification(tubeSpec);
+        tubeSpecWidget_->setSpecification(specs.first());
     } else {
         tubeSpecWidget_->clear();
     }
@@ -681,6 +884,7 @@ void BaseFormWidget::onSaveClicked()
 {
     if (!isFormValid()) {
         QStringList errors = getValidationErrors();
+        validator_->revealAll();
         QMessageBox::warning(this, "Validation Error", 
                            "Please fix the following errors:\n\n" + errors.join("\n"));
         return;
@@ -702,6 +906,12 @@ void BaseFormWidget::onPrintClicked()
     printForm();
 }
 
+void BaseFormWidget::onDisplayClicked()
+{
+    // MainWindow saves the case first and shows it full-screen
+    emit displayRequested();
+}
+
 void BaseFormWidget::onBackClicked()
 {
     // Navigate back to case selection by emitting a signal
@@ -711,42 +921,89 @@ void BaseFormWidget::onBackClicked()
 
 void BaseFormWidget::onPatientInfoChanged()
 {
-    if (!loading_) {
-        justSaved_ = false;
-        emit formChanged();
-    }
+    markFieldDirty(PatientField);
 }
 
 void BaseFormWidget::onEmergencyScenarioSelected(const QString& scenario)
 {
+    emergencyScenario_ = scenario;
     updateEmergencyAdvice();
     emit emergencyScenarioChanged(scenario);
-    if (!loading_) {
-        emit formChanged();
-    }
+    markFieldDirty(EmergencyScenarioField);
 }
 
 void BaseFormWidget::onSuctionSizeChanged(int size)
 {
-    emergencyPanelOverlay_->setSuctionSize(size);
-    if (!loading_) {
-        emit formChanged();
+    Q_UNUSED(size);
+    updateOverlayParameters();
+    if (!applyingSuctionRecommendation_ && !suctionSizeOverridden_) {
+        suctionSizeOverridden_ = true;
+        updateSuctionRecommendButton();
     }
+    markFieldDirty(SuctionField);
 }
 
+SuctionRecommendation BaseFormWidget::suctionRecommendation() const
+{
+    // Runs on every keystroke, so it reads the widgets rather than building a row
+    bool ok = false;
+    const double size = tubeSpecWidget_->sizeText().toDouble(&ok);
+    if (!ok) {
+        return SuctionRecommendation();
+    }
+    const TubeManufacturer manufacturer = SATrachTube::manufacturerFromName(tubeSpecWidget_->manufacturer());
+    return SuctionRecommendations::instance().recommend(manufacturer, tubeSpecWidget_->typeText(),
+                                                        TubeCatalog::toTenths(size));
+}
 
-void BaseFormWidget::onFormFieldChanged()
+void BaseFormWidget::applySuctionRecommendation()
 {
-    if (!loading_) {
-        justSaved_ = false;
-        currentCase_.setUpdatedAt(QDateTime::currentDateTime());
-        emit formChanged();
+    if (isUpdating() || frozen_) return;
+
+    if (!suctionSizeOverridden_ || !suctionDepthOverridden_) {
+        const SuctionRecommendation recommendation = suctionRecommendation();
+
+        // Values the form fills in itself are not overrides
+        applyingSuctionRecommendation_ = true;
+        if (!suctionSizeOverridden_ && recommendation.catheterFr > 0) {
+            suctionSizeSpinBox_->setValue(recommendation.catheterFr);
+        }
+        if (!suctionDepthOverridden_ && recommendation.depthMm > 0) {
+            const QString depth = recommendation.depthText();
+            if (suctionDepthEdit_->text() != depth) {
+                suctionDepthEdit_->setText(depth);
+            }
+        }
+        applyingSuctionRecommendation_ = false;
     }
+
+    updateSuctionRecommendButton();
+}
+
+void BaseFormWidget::updateSuctionRecommendButton()
+{
+    if (!suctionSizeOverridden_ && !suctionDepthOverridden_) {
+        suctionRecommendButton_->setVisible(false);
+        return;
+    }
+
+    const SuctionRecommendation recommendation = suctionRecommendation();
+    if (!recommendation.isValid()) {
+        suctionRecommendButton_->setVisible(false);
+        return;
+    }
+
+    QString text = QString("Use recommended: %1 Fr").arg(recommendation.catheterFr);
+    if (recommendation.depthMm > 0) {
+        text += ", " + recommendation.depthText();
+    }
+    suctionRecommendButton_->setText(text);
+    suctionRecommendButton_->setVisible(true);
 }
 
 void BaseFormWidget::saveFormData()
 {
-    currentCase_ = getCase();
+    syncDirtyFields();
 }
 
 void BaseFormWidget::updateEmergencyAdvice()
@@ -757,6 +1014,12 @@ void BaseFormWidget::updateEmergencyAdvice()
 
 void BaseFormWidget::printForm()
 {
+    // Lay the card out on a worker while the print dialog is up
+    const Case snapshot = getCase();
+    QFuture<PrintPage> pendingPage = QtConcurrent::run([snapshot]() {
+        return CasePrintLayout::layoutCase(snapshot);
+    });
+
     QPrinter printer(QPrinter::HighResolution);
     printer.setPageOrientation(QPageLayout::Landscape);
     printer.setPageMargins(QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter);
@@ -767,19 +1030,8 @@ void BaseFormWidget::printForm()
     if (printDialog.exec() == QDialog::Accepted) {
         QPainter painter(&printer);
         
-        // Get the size of the widget and the page
-        QSize widgetSize = this->size();
-        QRectF pageRect = printer.pageRect(QPrinter::DevicePixel);
-        
-        // Calculate scale factor to fit the entire form on the page
-        double scaleX = pageRect.width() / widgetSize.width();
-        double scaleY = pageRect.height() / widgetSize.height();
-        double scale = qMin(scaleX, scaleY);
-        
-        // Apply scaling
-        painter.scale(scale, scale);
-        
-        // Render the widget
-        render(&painter);
+        // Painter origin is already the top-left of the printable area
+        QRectF pageRect(QPointF(0, 0), printer.pageRect(QPrinter::DevicePixel).size());
+        CasePrintLayout::paintPage(&painter, pendingPage.result(), pageRect);
     }
 }
\ No newline at end of file
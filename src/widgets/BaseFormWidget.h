@@ -15,69 +15,114 @@
 #include <QGroupBox>
 #include <QScrollArea>
 #include <QTimer>
+#include <QSignalBlocker>
+#include <QVector>
+#include <vector>
 #include "models/Case.h"
+#include "models/EmergencyScenarioRegistry.h"
 #include "widgets/PatientInfoWidget.h"
-#include "widgets/EmergencyPanelOverlay.h"
 #include "widgets/TubeSpecificationWidget.h"
 #include "widgets/TextWrapDelegate.h"
+#include "utils/SuctionRecommendations.h"
+#include "widgets/FormSections.h"
+#include "widgets/FormValidator.h"
 
 class BaseFormWidget : public QWidget
 {
     Q_OBJECT
 
 public:
-    explicit BaseFormWidget(CaseType caseType, QWidget* parent = nullptr);
-    
-    void finishSetup(); // Call this after construction to complete form-specific setup
+    // Case fields mirrored by the form; a dirty field's widget is newer than the edit model
+    enum FormField : quint32 {
+        PatientField = 1u << 0,
+        TubeSpecField = 1u << 1,
+        EmergencyScenarioField = 1u << 2,
+        SuctionField = 1u << 3,
+        SpecialCommentsField = 1u << 4,
+        TrachIndicationField = 1u << 5,
+        SurgeonField = 1u << 6,
+        DateOfSurgeryField = 1u << 7,
+        FirstTrachChangeField = 1u << 8,
+        AirwayDiagnosisField = 1u << 9,
+        ProcedureField = 1u << 10,
+        ExtubationDateField = 1u << 11,
+        AllFields = (1u << 12) - 1
+    };
+
+    explicit BaseFormWidget(CaseType caseType = CaseType::Tracheostomy, QWidget* parent = nullptr);
     
+    // Loading a case of another type switches the form to that type
     virtual void setCase(const Case& case_);
-    virtual Case getCase() const;
+    Case getCase() const; // Only re-reads the widgets of dirty fields
+
+    // Records a successful save without touching any widget
+    void markSaved(const QString& filePath, const QDateTime& updatedAt);
+    quint32 dirtyFields() const { return dirtyFields_; }
     
     void setFrozen(bool frozen);
     bool isFrozen() const { return frozen_; }
+
+    // Read-only while the form is frozen, so the case is not changed
+    void showEmergencyOverlay();
     
-    virtual bool isFormValid() const;
-    virtual QStringList getValidationErrors() const;
+    // Kept current by the validation rules on every edit
+    bool isFormValid() const { return validator_->isValid(); }
+    QStringList getValidationErrors() const { return validator_->errors(); }
     
     void clear();
     
     CaseType getCaseType() const { return caseType_; }
+    // Starts a blank case of the type; only the case type's section is rebuilt
+    void setCaseType(CaseType caseType);
     
     bool wasJustSaved() const { return justSaved_; }
     void setJustSaved(bool saved) { justSaved_ = saved; }
 
+    // Bulk population: field signals are blocked and painting is held until
+    // the outermost endUpdate(), which emits formChanged at most once
+    void beginUpdate();
+    void endUpdate(bool markModified = false);
+    bool isUpdating() const { return updateDepth_ > 0; }
+
 signals:
     void saveRequested();
     void freezeModeToggled(bool frozen);
     void formChanged();
     void emergencyScenarioChanged(const QString& scenario);
     void backRequested();
+    void displayRequested();
 
 protected slots:
     void onSaveClicked();
     void onFreezeClicked();
     void onPrintClicked();
+    void onDisplayClicked();
     void onBackClicked();
     void onPatientInfoChanged();
     void onEmergencyScenarioSelected(const QString& scenario);
     void onSuctionSizeChanged(int size);
-    void onFormFieldChanged();
 
 protected:
     virtual void setupUI();
     virtual void setupSidePanel();
     virtual void setupActionButtons();
-    virtual void setupFormSpecificFields() {}
     
     virtual void updateStyles();
     virtual void updateEmergencyAdvice();
+
+    // The shared emergency overlay follows whichever form is on screen
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
     
     
     CaseType caseType_;
-    Case currentCase_;
+    // Edit model; getCase() const folds dirty widgets into it on demand
+    mutable Case currentCase_;
+    mutable quint32 dirtyFields_;
     bool frozen_;
     bool justSaved_;
-    bool loading_;
+    int updateDepth_;
+    std::vector<QSignalBlocker> updateBlockers_;
     QSize screenSize_;
     
     QScrollArea* scrollArea_;
@@ -86,7 +131,14 @@ protected:
     QVBoxLayout* contentLayout_;
     QVBoxLayout* rightLayout_;
     QVBoxLayout* formFieldsLayout_;
+
+    // The case type's own fields, one edit per row of section_
+    const FormSection* section_;
+    QGroupBox* sectionGroup_;
+    QVector<QLineEdit*> sectionEdits_;
     
+    QWidget* headerCard_;
+    QWidget* accentBar_;
     QLabel* headerLabel_;
     QLabel* logoLabel_;
     PatientInfoWidget* patientInfoWidget_;
@@ -97,29 +149,53 @@ protected:
     QPushButton* moveUpButton_;
     QPushButton* moveDownButton_;
     
-    EmergencyPanelOverlay* emergencyPanelOverlay_;
+    // Shown in the shared overlay while this form is bound to it
+    QString emergencyScenario_;
     QPushButton* emergencyButton_;
 
     QGroupBox* sidePanelGroup_;
     QSpinBox* suctionSizeSpinBox_;
     QLineEdit* suctionDepthEdit_;
+    QPushButton* suctionRecommendButton_;
     QTextEdit* specialCommentsEdit_;
+
+    // Suction values staff typed over the tube recommendation
+    bool suctionSizeOverridden_;
+    bool suctionDepthOverridden_;
+    bool applyingSuctionRecommendation_;
     
     QPushButton* freezeButton_;
     QPushButton* saveButton_;
     QPushButton* printButton_;
+    QPushButton* displayButton_;
     QPushButton* backButton_;
+
+    FormValidator* validator_;
     
     void connectSignals();
     void loadFormData();
     void saveFormData();
+    void markFieldDirty(quint32 fields);
+    void syncDirtyFields() const;
     void updateTableFromCase();
     void updateCaseFromTable();
+
+    SuctionRecommendation suctionRecommendation() const;
+    void applySuctionRecommendation();
+    void updateSuctionRecommendButton();
     
 private:
     void setupHeader();
     void setupSpecTableButtons();
     void printForm();
+    void bindEmergencyOverlay();
+    // Read from the widgets, so the overlay follows edits that are not synced yet
+    ScenarioParameters scenarioParameters() const;
+    void updateOverlayParameters();
+    void applyCaseType(CaseType caseType);
+    void setupSection();
+    void applyCaseTypeStyle();
+    void setupValidation();
 };
 
 #endif // BASEFORMWIDGET_H
\ No newline at end of file
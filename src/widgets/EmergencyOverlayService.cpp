@@ -0,0 +1,82 @@
+#include "EmergencyOverlayService.h"
+#include "EmergencyPanelOverlay.h"
+
+EmergencyOverlayService* EmergencyOverlayService::instance_ = nullptr;
+
+EmergencyOverlayService::EmergencyOverlayService()
+    : QObject(nullptr)
+{
+}
+
+EmergencyOverlayService& EmergencyOverlayService::instance()
+{
+    if (!instance_) {
+        instance_ = new EmergencyOverlayService();
+    }
+    return *instance_;
+}
+
+void EmergencyOverlayService::attach(QWidget* window)
+{
+    if (overlay_) return;
+
+    overlay_ = new EmergencyPanelOverlay(window);
+    connect(overlay_, &EmergencyPanelOverlay::scenarioSelected, this, [this](const QString& scenario) {
+        emit scenarioSelected(owner_, scenario);
+    });
+    connect(overlay_, &EmergencyPanelOverlay::visibilityChanged,
+            this, &EmergencyOverlayService::overlayVisibilityChanged);
+}
+
+void EmergencyOverlayService::bind(QObject* owner, CaseType caseType, const ScenarioParameters& parameters,
+                                   const QString& scenario)
+{
+    owner_ = owner;
+    if (!overlay_) return;
+
+    overlay_->setCaseType(caseType);
+    overlay_->setParameters(parameters);
+    overlay_->setSelectedScenario(scenario);
+}
+
+void EmergencyOverlayService::release(QObject* owner)
+{
+    if (!isBoundTo(owner)) return;
+
+    owner_ = nullptr;
+    if (!overlay_) return;
+
+    // Back to the general protocols, with no scenario carried over
+    if (overlay_->isOverlayVisible()) {
+        overlay_->hideOverlay();
+    }
+    overlay_->showGeneralProtocols();
+    overlay_->setSelectedScenario(QString());
+}
+
+void EmergencyOverlayService::setParameters(QObject* owner, const ScenarioParameters& parameters)
+{
+    if (isBoundTo(owner) && overlay_) {
+        overlay_->setParameters(parameters);
+    }
+}
+
+void EmergencyOverlayService::setSelectedScenario(QObject* owner, const QString& scenario)
+{
+    if (isBoundTo(owner) && overlay_) {
+        overlay_->setSelectedScenario(scenario);
+    }
+}
+
+void EmergencyOverlayService::showOverlay(bool readOnly)
+{
+    if (overlay_) {
+        overlay_->setReadOnly(readOnly);
+        overlay_->showOverlay();
+    }
+}
+
+bool EmergencyOverlayService::isOverlayVisible() const
+{
+    return overlay_ && overlay_->isOverlayVisible();
+}
@@ -0,0 +1,52 @@
+#ifndef EMERGENCYOVERLAYSERVICE_H
+#define EMERGENCYOVERLAYSERVICE_H
+
+#include <QObject>
+#include <QPointer>
+#include "models/Case.h"
+#include "models/EmergencyScenarioRegistry.h"
+
+class QWidget;
+class EmergencyPanelOverlay;
+
+// The application's one emergency overlay. The active form binds it to its
+// case, so the overlay shows that case's instructions and its scenario
+// selections go back to that form. Unbound, it shows the general protocols.
+class EmergencyOverlayService : public QObject
+{
+    Q_OBJECT
+
+public:
+    static EmergencyOverlayService& instance();
+
+    // Creates the overlay over the main window; called once at startup
+    void attach(QWidget* window);
+    EmergencyPanelOverlay* overlay() const { return overlay_; }
+
+    // The owner's values replace whatever the overlay showed before
+    void bind(QObject* owner, CaseType caseType, const ScenarioParameters& parameters, const QString& scenario);
+    void release(QObject* owner);
+    bool isBoundTo(const QObject* owner) const { return owner && owner_ == owner; }
+
+    // Ignored unless the owner is bound
+    void setParameters(QObject* owner, const ScenarioParameters& parameters);
+    void setSelectedScenario(QObject* owner, const QString& scenario);
+
+    // Read-only shows the instructions without changing the bound case
+    void showOverlay(bool readOnly = false);
+    bool isOverlayVisible() const;
+
+signals:
+    // owner is nullptr when nothing was bound
+    void scenarioSelected(QObject* owner, const QString& scenario);
+    void overlayVisibilityChanged(bool visible);
+
+private:
+    EmergencyOverlayService();
+    static EmergencyOverlayService* instance_;
+
+    QPointer<EmergencyPanelOverlay> overlay_;
+    QPointer<QObject> owner_;
+};
+
+#endif // EMERGENCYOVERLAYSERVICE_H
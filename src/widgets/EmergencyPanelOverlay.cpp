@@ -1,11 +1,13 @@
 #include "EmergencyPanelOverlay.h"
 #include "utils/StyleManager.h"
-#include "models/EmergencyScenario.h"
+#include "core/EmergencyProtocolLoader.h"
 #include <QPainter>
 #include <QMouseEvent>
 #include <QKeyEvent>
 #include <QGuiApplication>
 #include <QScreen>
+#include <QScrollBar>
+#include <QAbstractTextDocumentLayout>
 
 EmergencyPanelOverlay::EmergencyPanelOverlay(QWidget* parent)
     : QWidget(parent)
@@ -20,13 +22,21 @@ EmergencyPanelOverlay::EmergencyPanelOverlay(QWidget* parent)
     , decannulationButton_(nullptr)
     , hemoptysisButton_(nullptr)
     , instructionsEdit_(nullptr)
+    , noInstructions_(nullptr)
+    , laidOutWidth_(0)
     , closeButton_(nullptr)
-    , suctionSize_(6)
+    , parameters_(ScenarioParameters::fromSuctionSize(DefaultSuctionSize))
+    , caseType_(CaseType::Tracheostomy)
+    , hasCaseType_(false)
     , visible_(false)
+    , readOnly_(false)
+    , lastOpenMs_(0.0)
+    , worstOpenMs_(0.0)
 {
     setupUI();
     setupButtonStyling();
     connectSignals();
+    renderInstructions();
     
     // Initially hidden
     hide();
@@ -167,6 +177,7 @@ void EmergencyPanelOverlay::setupUI()
     instructionsEdit_->setWordWrapMode(QTextOption::WordWrap);
     instructionsEdit_->setPlaceholderText("Select an emergency scenario to view instructions.");
     instructionsEdit_->setFont(StyleManager::instance().getEmergencyInstructionsFont());
+    instructionsEdit_->viewport()->installEventFilter(this);
     instructionsEdit_->setStyleSheet(
         "QTextEdit {"
         "   background-color: #FAFAFA;"
@@ -176,6 +187,9 @@ void EmergencyPanelOverlay::setupUI()
         "}"
     );
     instructionsLayout->addWidget(instructionsEdit_);
+
+    // Shown while no scenario is selected, so the placeholder text appears
+    noInstructions_ = new QTextDocument(this);
     
     contentLayout->addLayout(instructionsLayout);
     
@@ -252,30 +266,50 @@ void EmergencyPanelOverlay::connectSignals()
     connect(scenarioGroup_, QOverload<QAbstractButton*>::of(&QButtonGroup::buttonClicked), 
             this, &EmergencyPanelOverlay::onScenarioButtonClicked);
     connect(closeButton_, &QPushButton::clicked, this, &EmergencyPanelOverlay::hideOverlay);
+
+    // Revised protocols show up in the open overlay too
+    connect(&EmergencyProtocolLoader::instance(), &EmergencyProtocolLoader::protocolsChanged,
+            this, &EmergencyPanelOverlay::renderInstructions);
 }
 
 void EmergencyPanelOverlay::showOverlay()
 {
+    openTimer_.start();
+    const bool wasVisible = visible_;
     visible_ = true;
-    show();
-    raise();
-    setFocus();
     
-    // Ensure we're on top and cover the entire window
+    // Cover the entire window before showing, so the first frame is laid out once
     if (parentWidget()) {
         setGeometry(0, 0, parentWidget()->width(), parentWidget()->height());
     }
+    
+    show();
+    raise();
+    setFocus();
+
+    if (!wasVisible) {
+        emit visibilityChanged(true);
+    }
 }
 
 void EmergencyPanelOverlay::hideOverlay()
 {
+    const bool wasVisible = visible_;
     visible_ = false;
     hide();
+
+    if (readOnly_ && getSelectedScenario() != selectedScenario_) {
+        setSelectedScenario(selectedScenario_);
+    }
     
     // Return focus to parent
     if (parentWidget()) {
         parentWidget()->setFocus();
     }
+
+    if (wasVisible) {
+        emit visibilityChanged(false);
+    }
 }
 
 bool EmergencyPanelOverlay::isOverlayVisible() const
@@ -285,6 +319,8 @@ bool EmergencyPanelOverlay::isOverlayVisible() const
 
 void EmergencyPanelOverlay::setSelectedScenario(const QString& scenarioName)
 {
+    selectedScenario_ = scenarioName;
+
     // Clear all selections first
     scenarioGroup_->setExclusive(false);
     cantSuctionButton_->setChecked(false);
@@ -327,10 +363,28 @@ QString EmergencyPanelOverlay::getSelectedScenario() const
     return QString();
 }
 
-void EmergencyPanelOverlay::setSuctionSize(int size)
+void EmergencyPanelOverlay::setParameters(const ScenarioParameters& parameters)
 {
-    suctionSize_ = size;
-    updateInstructions();
+    if (parameters == parameters_) return;
+    parameters_ = parameters;
+    renderInstructions();
+}
+
+void EmergencyPanelOverlay::setCaseType(CaseType caseType)
+{
+    if (hasCaseType_ && caseType == caseType_) return;
+    caseType_ = caseType;
+    hasCaseType_ = true;
+    renderInstructions();
+}
+
+void EmergencyPanelOverlay::showGeneralProtocols()
+{
+    const ScenarioParameters defaults = ScenarioParameters::fromSuctionSize(DefaultSuctionSize);
+    if (!hasCaseType_ && parameters_ == defaults) return;
+    hasCaseType_ = false;
+    parameters_ = defaults;
+    renderInstructions();
 }
 
 void EmergencyPanelOverlay::paintEvent(QPaintEvent* event)
@@ -341,6 +395,30 @@ void EmergencyPanelOverlay::paintEvent(QPaintEvent* event)
     painter.fillRect(rect(), QColor(0, 0, 0, 150));
     
     QWidget::paintEvent(event);
+    
+    if (openTimer_.isValid()) {
+        lastOpenMs_ = openTimer_.nsecsElapsed() / 1e6;
+        worstOpenMs_ = qMax(worstOpenMs_, lastOpenMs_);
+        openTimer_.invalidate();
+        if (lastOpenMs_ > OpenWarningMs) {
+            qWarning("Emergency overlay took %.1f ms to open", lastOpenMs_);
+        }
+    }
+}
+
+bool EmergencyPanelOverlay::eventFilter(QObject* watched, QEvent* event)
+{
+    // Re-wrap every scenario once the viewport has its real width
+    if (watched == instructionsEdit_->viewport() && event->type() == QEvent::Resize) {
+        const int width = instructionsEdit_->viewport()->width();
+        if (width > 0 && width != laidOutWidth_) {
+            laidOutWidth_ = width;
+            for (const RenderedInstructions& rendered : std::as_const(renderedInstructions_)) {
+                layoutInstructions(rendered.document);
+            }
+        }
+    }
+    return QWidget::eventFilter(watched, event);
 }
 
 void EmergencyPanelOverlay::keyPressEvent(QKeyEvent* event)
@@ -366,39 +444,71 @@ void EmergencyPanelOverlay::mousePressEvent(QMouseEvent* event)
     QWidget::mousePressEvent(event);
 }
 
+void EmergencyPanelOverlay::setReadOnly(bool readOnly)
+{
+    if (readOnly == readOnly_) return;
+    readOnly_ = readOnly;
+    titleLabel_->setText(readOnly ? "Emergency Scenarios (form is frozen)" : "Emergency Scenarios");
+}
+
 void EmergencyPanelOverlay::onScenarioButtonClicked()
 {
-    QString selectedScenario = getSelectedScenario();
-    emit scenarioSelected(selectedScenario);
+    if (!readOnly_) {
+        selectedScenario_ = getSelectedScenario();
+        emit scenarioSelected(selectedScenario_);
+    }
     updateInstructions();
 }
 
-void EmergencyPanelOverlay::updateInstructions()
+void EmergencyPanelOverlay::renderInstructions()
 {
-    QString selectedScenario = getSelectedScenario();
-    
-    if (selectedScenario.isEmpty()) {
-        instructionsEdit_->clear();
-        return;
+    const EmergencyScenarioRegistry& registry = EmergencyScenarioRegistry::instance();
+    
+    for (const QString& name : registry.names()) {
+        const QString text = hasCaseType_ ? registry.render(name, caseType_, parameters_)
+                                          : registry.render(name, parameters_);
+        RenderedInstructions& rendered = renderedInstructions_[name];
+        
+        if (!rendered.document) {
+            rendered.document = new QTextDocument(this);
+            rendered.document->setUndoRedoEnabled(false);
+        } else if (rendered.text == text) {
+            continue;
+        }
+        
+        rendered.text = text;
+        rendered.document->setDefaultFont(instructionsEdit_->font());
+        rendered.document->setPlainText(text);
+        layoutInstructions(rendered.document);
     }
     
-    EmergencyScenario scenario = EmergencyScenario::getScenarioByName(selectedScenario);
-    QString instructions = scenario.getFormattedInstructions();
-    
-    if (selectedScenario == "can't ventilate" || selectedScenario == "decannulation") {
-        instructions = getInstructionsWithETTSize(instructions);
-    }
+    updateInstructions();
+}
+
+void EmergencyPanelOverlay::layoutInstructions(QTextDocument* document)
+{
+    if (!document || laidOutWidth_ <= 0) return;
+    document->setTextWidth(laidOutWidth_);
     
-    instructionsEdit_->setText(instructions);
-    emit instructionsChanged(instructions);
+    // Lays the text out now instead of on the first paint
+    document->documentLayout()->documentSize();
 }
 
-QString EmergencyPanelOverlay::getInstructionsWithETTSize(const QString& instructions) const
+void EmergencyPanelOverlay::updateInstructions()
 {
-    QString modifiedInstructions = instructions;
+    QString selectedScenario = getSelectedScenario();
     
-    QString ettSize = QString::number(suctionSize_) + ".0";
-    modifiedInstructions.replace("6.0 endotracheal tube", ettSize + " endotracheal tube");
+    auto it = renderedInstructions_.constFind(selectedScenario);
+    if (it == renderedInstructions_.constEnd() || !it->document) {
+        if (instructionsEdit_->document() != noInstructions_) {
+            instructionsEdit_->setDocument(noInstructions_);
+        }
+        return;
+    }
     
-    return modifiedInstructions;
+    if (instructionsEdit_->document() != it->document) {
+        instructionsEdit_->setDocument(it->document);
+        instructionsEdit_->verticalScrollBar()->setValue(0);
+    }
+    emit instructionsChanged(it->text);
 }
\ No newline at end of file
@@ -10,6 +10,11 @@
 #include <QTextEdit>
 #include <QButtonGroup>
 #include <QGroupBox>
+#include <QTextDocument>
+#include <QElapsedTimer>
+#include <QHash>
+#include "models/Case.h"
+#include "models/EmergencyScenarioRegistry.h"
 
 class EmergencyPanelOverlay : public QWidget
 {
@@ -18,19 +23,33 @@ class EmergencyPanelOverlay : public QWidget
 public:
     explicit EmergencyPanelOverlay(QWidget* parent = nullptr);
     
+    // Opening is timed up to the first painted frame
     void showOverlay();
     void hideOverlay();
     bool isOverlayVisible() const;
+    // Open-to-first-paint times in ms; 0 until the first open
+    double lastOpenMs() const { return lastOpenMs_; }
+    double worstOpenMs() const { return worstOpenMs_; }
     
     QString getSelectedScenario() const;
     void setSelectedScenario(const QString& scenarioName);
-    void setSuctionSize(int size);
+    // Scenarios can still be viewed, but picking one does not change the case
+    void setReadOnly(bool readOnly);
+    bool isReadOnly() const { return readOnly_; }
+    // Case values filled into the instructions' slots
+    void setParameters(const ScenarioParameters& parameters);
+    // Selects the case type's protocol variants
+    void setCaseType(CaseType caseType);
+    // Back to the general protocols and the default ETT size
+    void showGeneralProtocols();
 
 signals:
     void scenarioSelected(const QString& scenario);
     void instructionsChanged(const QString& instructions);
+    void visibilityChanged(bool visible);
 
 protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
     void paintEvent(QPaintEvent* event) override;
     void keyPressEvent(QKeyEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
@@ -43,7 +62,8 @@ private:
     void setupButtonStyling();
     void connectSignals();
     void updateInstructions();
-    QString getInstructionsWithETTSize(const QString& instructions) const;
+    void renderInstructions();
+    void layoutInstructions(QTextDocument* document);
     QString getButtonStyleSheet(const QString& color) const;
 
     // Main components
@@ -62,13 +82,37 @@ private:
     
     // Instructions
     QTextEdit* instructionsEdit_;
+
+    // Every scenario is rendered and laid out ahead of time, so selecting
+    // one only swaps the edit's document
+    struct RenderedInstructions {
+        QString text;
+        QTextDocument* document = nullptr;
+    };
+    QHash<QString, RenderedInstructions> renderedInstructions_;
+    QTextDocument* noInstructions_;
+    // Viewport width the documents are laid out for; 0 until it is sized
+    int laidOutWidth_;
     
     // Close button
     QPushButton* closeButton_;
     
     // State
-    int suctionSize_;
+    ScenarioParameters parameters_;
+    CaseType caseType_;
+    bool hasCaseType_;
     bool visible_;
+    bool readOnly_;
+    // The case's own scenario, restored after browsing read-only
+    QString selectedScenario_;
+
+    static const int DefaultSuctionSize = 6;
+
+    // Slower opens are logged
+    static const int OpenWarningMs = 50;
+    QElapsedTimer openTimer_;
+    double lastOpenMs_;
+    double worstOpenMs_;
 };
 
 #endif // EMERGENCYPANELOVERLAY_H
\ No newline at end of file
@@ -14,6 +14,9 @@ EscOverlayMenu::EscOverlayMenu(QWidget* parent)
     , openCaseButton_(nullptr)
     , saveButton_(nullptr)
     , saveAsButton_(nullptr)
+    , batchPrintButton_(nullptr)
+    , displayModeButton_(nullptr)
+    , wallDisplayButton_(nullptr)
     , increaseFontButton_(nullptr)
     , decreaseFontButton_(nullptr)
     , resetFontButton_(nullptr)
@@ -77,6 +80,9 @@ void EscOverlayMenu::setupUI()
     openCaseButton_ = new QPushButton("Open Case");
     saveButton_ = new QPushButton("Save");
     saveAsButton_ = new QPushButton("Save As");
+    batchPrintButton_ = new QPushButton("Print Cards");
+    displayModeButton_ = new QPushButton("Display Mode");
+    wallDisplayButton_ = new QPushButton("Wall Display");
     increaseFontButton_ = new QPushButton("Font Size +");
     decreaseFontButton_ = new QPushButton("Font Size -");
     resetFontButton_ = new QPushButton("Reset Font");
@@ -85,7 +91,7 @@ void EscOverlayMenu::setupUI()
     
     // Set minimum height and cursor for all buttons
     QList<QPushButton*> buttons = {newCaseButton_, openCaseButton_, saveButton_, saveAsButton_,
-                                   increaseFontButton_, decreaseFontButton_, resetFontButton_,
+                                   batchPrintButton_, displayModeButton_, wallDisplayButton_, increaseFontButton_, decreaseFontButton_, resetFontButton_,
                                    aboutButton_, exitButton_};
 
     for (QPushButton* button : buttons) {
@@ -104,6 +110,9 @@ void EscOverlayMenu::setupUI()
     buttonLayout_->addWidget(resetFontButton_, 2, 0);
     buttonLayout_->addWidget(aboutButton_, 2, 1);
     buttonLayout_->addWidget(exitButton_, 2, 2);
+    buttonLayout_->addWidget(batchPrintButton_, 3, 0);
+    buttonLayout_->addWidget(displayModeButton_, 3, 1);
+    buttonLayout_->addWidget(wallDisplayButton_, 3, 2);
     
     panelLayout->addLayout(buttonLayout_);
     panelLayout->addStretch();
@@ -120,6 +129,9 @@ void EscOverlayMenu::setupUI()
     connect(openCaseButton_, &QPushButton::clicked, this, &EscOverlayMenu::onOpenCaseClicked);
     connect(saveButton_, &QPushButton::clicked, this, &EscOverlayMenu::onSaveClicked);
     connect(saveAsButton_, &QPushButton::clicked, this, &EscOverlayMenu::onSaveAsClicked);
+    connect(batchPrintButton_, &QPushButton::clicked, this, &EscOverlayMenu::onBatchPrintClicked);
+    connect(displayModeButton_, &QPushButton::clicked, this, &EscOverlayMenu::onDisplayModeClicked);
+    connect(wallDisplayButton_, &QPushButton::clicked, this, &EscOverlayMenu::onWallDisplayClicked);
     connect(increaseFontButton_, &QPushButton::clicked, this, &EscOverlayMenu::onIncreaseFontClicked);
     connect(decreaseFontButton_, &QPushButton::clicked, this, &EscOverlayMenu::onDecreaseFontClicked);
     connect(resetFontButton_, &QPushButton::clicked, this, &EscOverlayMenu::onResetFontClicked);
@@ -136,6 +148,9 @@ void EscOverlayMenu::setupButtonStyling()
     openCaseButton_->setStyleSheet(getButtonStyleSheet("#1976D2", "#1565C0"));
     saveButton_->setStyleSheet(getButtonStyleSheet("#1976D2", "#1565C0"));
     saveAsButton_->setStyleSheet(getButtonStyleSheet("#1976D2", "#1565C0"));
+    batchPrintButton_->setStyleSheet(getButtonStyleSheet("#1976D2", "#1565C0"));
+    displayModeButton_->setStyleSheet(getButtonStyleSheet("#1976D2", "#1565C0"));
+    wallDisplayButton_->setStyleSheet(getButtonStyleSheet("#1976D2", "#1565C0"));
 
     // Font buttons (teal theme)
     increaseFontButton_->setStyleSheet(getButtonStyleSheet("#00897B", "#00695C"));
@@ -289,6 +304,24 @@ void EscOverlayMenu::onSaveAsClicked()
     emit saveAsRequested();
 }
 
+void EscOverlayMenu::onBatchPrintClicked()
+{
+    hideMenu();
+    emit batchPrintRequested();
+}
+
+void EscOverlayMenu::onDisplayModeClicked()
+{
+    hideMenu();
+    emit displayModeRequested();
+}
+
+void EscOverlayMenu::onWallDisplayClicked()
+{
+    hideMenu();
+    emit wallDisplayRequested();
+}
+
 void EscOverlayMenu::onIncreaseFontClicked()
 {
     hideMenu();
@@ -25,6 +25,9 @@ signals:
     void openCaseRequested();
     void saveRequested();
     void saveAsRequested();
+    void batchPrintRequested();
+    void displayModeRequested();
+    void wallDisplayRequested();
     void increaseFontRequested();
     void decreaseFontRequested();
     void resetFontRequested();
@@ -41,6 +44,9 @@ private slots:
     void onOpenCaseClicked();
     void onSaveClicked();
     void onSaveAsClicked();
+    void onBatchPrintClicked();
+    void onDisplayModeClicked();
+    void onWallDisplayClicked();
     void onIncreaseFontClicked();
     void onDecreaseFontClicked();
     void onResetFontClicked();
@@ -60,6 +66,9 @@ private:
     QPushButton* openCaseButton_;
     QPushButton* saveButton_;
     QPushButton* saveAsButton_;
+    QPushButton* batchPrintButton_;
+    QPushButton* displayModeButton_;
+    QPushButton* wallDisplayButton_;
     QPushButton* increaseFontButton_;
     QPushButton* decreaseFontButton_;
     QPushButton* resetFontButton_;
@@ -0,0 +1,60 @@
+#include "FormSections.h"
+#include "BaseFormWidget.h"
+#include <iterator>
+
+namespace {
+
+const FormSectionField TRACHEOSTOMY_FIELDS[] = {
+    { BaseFormWidget::TrachIndicationField, "Trach Indication:", "Enter tracheostomy indication",
+      &Case::getTrachIndication, &Case::setTrachIndication }
+};
+
+const FormSectionField NEW_TRACHEOSTOMY_FIELDS[] = {
+    { BaseFormWidget::TrachIndicationField, "Trach Indication:", "Enter tracheostomy indication",
+      &Case::getTrachIndication, &Case::setTrachIndication },
+    { BaseFormWidget::SurgeonField, "Surgeon:", "Enter surgeon name",
+      &Case::getSurgeon, &Case::setSurgeon },
+    { BaseFormWidget::DateOfSurgeryField, "Date of Surgery:", "MM/DD/YYYY",
+      &Case::getDateOfSurgery, &Case::setDateOfSurgery },
+    { BaseFormWidget::FirstTrachChangeField, "First Trach Change:", "MM/DD/YYYY",
+      &Case::getFirstTrachChange, &Case::setFirstTrachChange }
+};
+
+const FormSectionField DIFFICULT_AIRWAY_FIELDS[] = {
+    { BaseFormWidget::AirwayDiagnosisField, "Airway Diagnosis:", "Enter airway diagnosis",
+      &Case::getAirwayDiagnosis, &Case::setAirwayDiagnosis }
+};
+
+const FormSectionField LTR_FIELDS[] = {
+    { BaseFormWidget::ProcedureField, "Procedure:", "Enter procedure details",
+      &Case::getProcedure, &Case::setProcedure },
+    { BaseFormWidget::SurgeonField, "Surgeon:", "Enter surgeon name",
+      &Case::getSurgeon, &Case::setSurgeon },
+    { BaseFormWidget::DateOfSurgeryField, "Date of Surgery:", "MM/DD/YYYY",
+      &Case::getDateOfSurgery, &Case::setDateOfSurgery },
+    { BaseFormWidget::ExtubationDateField, "Extubation Date:", "MM/DD/YYYY",
+      &Case::getExtubationDate, &Case::setExtubationDate }
+};
+
+// Indexed by CaseType
+const FormSection SECTIONS[] = {
+    { CaseType::Tracheostomy, "TRACHEOSTOMY FORM", "Tracheostomy Information",
+      TRACHEOSTOMY_FIELDS, int(std::size(TRACHEOSTOMY_FIELDS)) },
+    { CaseType::NewTracheostomy, "NEW TRACHEOSTOMY FORM", "New Tracheostomy Information",
+      NEW_TRACHEOSTOMY_FIELDS, int(std::size(NEW_TRACHEOSTOMY_FIELDS)) },
+    { CaseType::DifficultAirway, "DIFFICULT AIRWAY FORM", "Airway Information",
+      DIFFICULT_AIRWAY_FIELDS, int(std::size(DIFFICULT_AIRWAY_FIELDS)) },
+    { CaseType::LTR, "LARYNGOTRACHEAL RECONSTRUCTION (LTR) FORM", "LTR Information",
+      LTR_FIELDS, int(std::size(LTR_FIELDS)) }
+};
+
+} // namespace
+
+const FormSection& FormSections::forCaseType(CaseType caseType)
+{
+    const int index = int(caseType);
+    if (index < 0 || index >= int(std::size(SECTIONS))) {
+        return SECTIONS[0];
+    }
+    return SECTIONS[index];
+}
@@ -0,0 +1,33 @@
+#ifndef FORMSECTIONS_H
+#define FORMSECTIONS_H
+
+#include <QString>
+#include "models/Case.h"
+
+// One text field of a case type's section: the form's dirty bit for it, its
+// label and the Case accessors it mirrors
+struct FormSectionField {
+    quint32 field;
+    const char* label;
+    const char* placeholder;
+    const QString& (Case::*get)() const;
+    void (Case::*set)(const QString&);
+};
+
+// What sets one case type's form apart. Everything else in BaseFormWidget is
+// shared, so switching case type only rebuilds this part.
+struct FormSection {
+    CaseType caseType;
+    const char* formTitle;
+    const char* groupTitle;
+    const FormSectionField* fields;
+    int fieldCount;
+};
+
+namespace FormSections {
+
+const FormSection& forCaseType(CaseType caseType);
+
+} // namespace FormSections
+
+#endif // FORMSECTIONS_H
@@ -0,0 +1,103 @@
+#include "FormValidator.h"
+#include <QStyle>
+#include <QVariant>
+
+FormValidator::FormValidator(QObject* parent)
+    : QObject(parent)
+    , failingCount_(0)
+    , shownFields_(0)
+{
+}
+
+void FormValidator::setRules(const QVector<Rule>& rules)
+{
+    rules_ = rules;
+    failing_.fill(false, rules_.size());
+    failingCount_ = 0;
+    evaluate(~0u);
+    updateWidgets(~0u);
+}
+
+void FormValidator::revalidate(quint32 fields)
+{
+    shownFields_ |= fields;
+    evaluate(fields);
+    updateWidgets(fields);
+}
+
+void FormValidator::reset()
+{
+    shownFields_ = 0;
+    evaluate(~0u);
+    updateWidgets(~0u);
+}
+
+void FormValidator::revealAll()
+{
+    shownFields_ = ~0u;
+    updateWidgets(~0u);
+}
+
+QStringList FormValidator::errors() const
+{
+    QStringList messages;
+    for (int i = 0; i < rules_.size(); ++i) {
+        if (failing_.at(i)) {
+            messages << rules_.at(i).message;
+        }
+    }
+    return messages;
+}
+
+void FormValidator::evaluate(quint32 fields)
+{
+    const bool wasValid = isValid();
+
+    for (int i = 0; i < rules_.size(); ++i) {
+        if (!(rules_.at(i).dependsOn & fields)) continue;
+
+        const bool failing = !rules_.at(i).passes();
+        if (failing != failing_.at(i)) {
+            failing_[i] = failing;
+            failingCount_ += failing ? 1 : -1;
+        }
+    }
+
+    if (wasValid != isValid()) {
+        emit validityChanged(isValid());
+    }
+}
+
+void FormValidator::updateWidgets(quint32 fields)
+{
+    // A widget can carry several rules; its state covers all of them
+    QVector<QWidget*> updated;
+    for (const Rule& rule : rules_) {
+        QWidget* widget = rule.widget;
+        if (!widget || !(rule.dependsOn & fields) || updated.contains(widget)) continue;
+        updated.append(widget);
+
+        QStringList messages;
+        for (int i = 0; i < rules_.size(); ++i) {
+            if (rules_.at(i).widget == widget && failing_.at(i) && (rules_.at(i).dependsOn & shownFields_)) {
+                messages << rules_.at(i).message;
+            }
+        }
+        setWidgetError(widget, messages);
+    }
+}
+
+void FormValidator::setWidgetError(QWidget* widget, const QStringList& messages)
+{
+    const bool invalid = !messages.isEmpty();
+    const QString toolTip = messages.join("\n");
+    if (widget->property("invalid").toBool() == invalid && widget->toolTip() == toolTip) return;
+
+    widget->setToolTip(toolTip);
+    widget->setProperty("invalid", invalid);
+
+    // Re-polish so [invalid="true"] style sheet rules take effect
+    widget->style()->unpolish(widget);
+    widget->style()->polish(widget);
+    widget->update();
+}
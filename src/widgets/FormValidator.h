@@ -0,0 +1,56 @@
+#ifndef FORMVALIDATOR_H
+#define FORMVALIDATOR_H
+
+#include <QObject>
+#include <QPointer>
+#include <QStringList>
+#include <QVector>
+#include <QWidget>
+#include <functional>
+
+// Rule-table validation for a form. Each rule names the form fields it reads,
+// so an edit re-runs only the rules that depend on the changed fields and the
+// overall result is kept as a count of failing rules.
+class FormValidator : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Rule {
+        quint32 dependsOn;
+        QString message;
+        std::function<bool()> passes;
+        QPointer<QWidget> widget; // Flagged inline while the rule fails
+    };
+
+    explicit FormValidator(QObject* parent = nullptr);
+
+    // Replaces the table and evaluates every rule
+    void setRules(const QVector<Rule>& rules);
+
+    // Re-runs the rules reading any of the fields, which then show inline errors
+    void revalidate(quint32 fields);
+    // Re-runs every rule with inline errors hidden, as after loading a case
+    void reset();
+    // Shows inline errors for every failing rule, as after a refused save
+    void revealAll();
+
+    bool isValid() const { return failingCount_ == 0; }
+    QStringList errors() const;
+
+signals:
+    void validityChanged(bool valid);
+
+private:
+    QVector<Rule> rules_;
+    QVector<bool> failing_;
+    int failingCount_;
+    // Fields edited since the last reset; only their failures are shown inline
+    quint32 shownFields_;
+
+    void evaluate(quint32 fields);
+    void updateWidgets(quint32 fields);
+    void setWidgetError(QWidget* widget, const QStringList& messages);
+};
+
+#endif // FORMVALIDATOR_H
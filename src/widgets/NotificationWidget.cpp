@@ -1,52 +1,51 @@
 #include "NotificationWidget.h"
 #include "utils/StyleManager.h"
-#include <QVBoxLayout>
-#include <QGraphicsOpacityEffect>
-#include <QShowEvent>
-#include <QResizeEvent>
-#include <QGuiApplication>
-#include <QScreen>
+#include <QPainter>
+#include <QFontMetrics>
+#include <QEvent>
+
+namespace {
+// Text inset inside the rounded background
+const int H_PADDING = 15;
+const int V_PADDING = 10;
+const int CORNER_RADIUS = 8;
+const int BOTTOM_OFFSET = 80;
+}
 
 NotificationWidget::NotificationWidget(QWidget* parent)
     : QWidget(parent)
-    , messageLabel_(nullptr)
     , hideTimer_(nullptr)
     , fadeAnimation_(nullptr)
+    , active_(false)
+    , opacity_(1.0)
 {
     setupUI();
     setupAnimation();
-    
+
+    if (parent) {
+        parent->installEventFilter(this);
+    }
+
     // Initially hidden
     setVisible(false);
 }
 
 void NotificationWidget::setupUI()
 {
-    setWindowFlags(Qt::FramelessWindowHint | Qt::Tool | Qt::WindowStaysOnTopHint | Qt::WindowTransparentForInput);
-    setAttribute(Qt::WA_TranslucentBackground);
-    
-    // Create layout
-    QVBoxLayout* layout = new QVBoxLayout(this);
-    layout->setContentsMargins(15, 10, 15, 10);
-    
-    // Create message label
-    messageLabel_ = new QLabel();
-    messageLabel_->setAlignment(Qt::AlignCenter);
-    messageLabel_->setWordWrap(true);
-    int fontSize = StyleManager::instance().getNotificationFontSize();
-    messageLabel_->setStyleSheet(QString(
-        "QLabel {"
-        "   background-color: rgba(0, 0, 0, 180);"
-        "   color: white;"
-        "   border-radius: 8px;"
-        "   padding: 10px 15px;"
-        "   font-size: %1px;"
-        "   font-weight: bold;"
-        "}"
-    ).arg(fontSize));
-    
-    layout->addWidget(messageLabel_);
-    
+    // Child overlay: never takes input, never gets its own window
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setAttribute(Qt::WA_NoSystemBackground);
+    setFocusPolicy(Qt::NoFocus);
+
+    // Severity styles are fixed for the lifetime of the widget
+    backgrounds_[Info] = QColor(0, 0, 0, 180);
+    backgrounds_[Success] = QColor(34, 139, 34, 180);
+    backgrounds_[Error] = QColor(220, 20, 60, 180);
+
+    font_ = font();
+    font_.setPixelSize(StyleManager::instance().getNotificationFontSize());
+    font_.setBold(true);
+
     // Create hide timer
     hideTimer_ = new QTimer(this);
     hideTimer_->setSingleShot(true);
@@ -55,122 +54,184 @@ void NotificationWidget::setupUI()
 
 void NotificationWidget::setupAnimation()
 {
-    // Create fade animation
-    fadeAnimation_ = new QPropertyAnimation(this, "windowOpacity");
-    fadeAnimation_->setDuration(300);
-    connect(fadeAnimation_, &QPropertyAnimation::finished, this, &NotificationWidget::hideNotification);
+    // Animates the painter opacity, not the window
+    fadeAnimation_ = new QPropertyAnimation(this, "opacity", this);
+    fadeAnimation_->setDuration(FADE_MS);
+    fadeAnimation_->setStartValue(1.0);
+    fadeAnimation_->setEndValue(0.0);
+    connect(fadeAnimation_, &QPropertyAnimation::finished, this, &NotificationWidget::onFadeFinished);
 }
 
 void NotificationWidget::showNotification(const QString& message, int duration)
 {
-    messageLabel_->setText(message);
-    int fontSize = StyleManager::instance().getNotificationFontSize();
-    messageLabel_->setStyleSheet(QString(
-        "QLabel {"
-        "   background-color: rgba(0, 0, 0, 180);"
-        "   color: white;"
-        "   border-radius: 8px;"
-        "   padding: 10px 15px;"
-        "   font-size: %1px;"
-        "   font-weight: bold;"
-        "}"
-    ).arg(fontSize));
-    
-    positionWidget();
-    setWindowOpacity(1.0);
-    show();
-    raise();
-    
-    hideTimer_->start(duration);
+    enqueue(message, Info, duration);
 }
 
 void NotificationWidget::showError(const QString& message, int duration)
 {
-    messageLabel_->setText(message);
-    int fontSize = StyleManager::instance().getNotificationFontSize();
-    messageLabel_->setStyleSheet(QString(
-        "QLabel {"
-        "   background-color: rgba(220, 20, 60, 180);"
-        "   color: white;"
-        "   border-radius: 8px;"
-        "   padding: 10px 15px;"
-        "   font-size: %1px;"
-        "   font-weight: bold;"
-        "}"
-    ).arg(fontSize));
-    
-    positionWidget();
-    setWindowOpacity(1.0);
-    show();
-    raise();
-    
-    hideTimer_->start(duration);
+    enqueue(message, Error, duration);
 }
 
 void NotificationWidget::showSuccess(const QString& message, int duration)
 {
-    messageLabel_->setText(message);
-    int fontSize = StyleManager::instance().getNotificationFontSize();
-    messageLabel_->setStyleSheet(QString(
-        "QLabel {"
-        "   background-color: rgba(34, 139, 34, 180);"
-        "   color: white;"
-        "   border-radius: 8px;"
-        "   padding: 10px 15px;"
-        "   font-size: %1px;"
-        "   font-weight: bold;"
-        "}"
-    ).arg(fontSize));
-    
-    positionWidget();
-    setWindowOpacity(1.0);
+    enqueue(message, Success, duration);
+}
+
+void NotificationWidget::setOpacity(qreal opacity)
+{
+    if (qFuzzyCompare(opacity_, opacity)) {
+        return;
+    }
+    opacity_ = opacity;
+    update();
+}
+
+void NotificationWidget::enqueue(const QString& message, Severity severity, int duration)
+{
+    // Same message already on screen: bump the counter
+    if (active_ && current_.severity == severity && current_.message == message) {
+        current_.count++;
+        updateDisplayText();
+        updateGeometryForText();
+        if (queue_.isEmpty()) {
+            // Nothing waiting, so keep it up for the full duration again
+            fadeAnimation_->stop();
+            setOpacity(1.0);
+            hideTimer_->start(qMax(duration, current_.duration));
+        } else if (hideTimer_->isActive() && hideTimer_->remainingTime() > MIN_DISPLAY_MS) {
+            // Others are waiting: a repeat may only bring the hide closer,
+            // never push it back, or a stream of repeats would starve them
+            hideTimer_->start(MIN_DISPLAY_MS);
+        }
+        update();
+        return;
+    }
+
+    // Same message already waiting: merge into it
+    for (Entry& entry : queue_) {
+        if (entry.severity == severity && entry.message == message) {
+            entry.count++;
+            entry.duration = qMax(entry.duration, duration);
+            return;
+        }
+    }
+
+    // Cap the backlog, dropping the oldest non-error message first
+    if (queue_.size() >= MAX_QUEUED) {
+        int dropIndex = 0;
+        for (int i = 0; i < queue_.size(); ++i) {
+            if (queue_[i].severity != Error) {
+                dropIndex = i;
+                break;
+            }
+        }
+        queue_.removeAt(dropIndex);
+    }
+
+    Entry entry;
+    entry.message = message;
+    entry.severity = severity;
+    entry.duration = duration;
+    queue_.append(entry);
+
+    if (!active_) {
+        showNext();
+        return;
+    }
+
+    // Something is waiting: cut the current one short, but not below the minimum
+    if (hideTimer_->isActive()) {
+        int minimumLeft = qMax(0, MIN_DISPLAY_MS - static_cast<int>(shownTimer_.elapsed()));
+        if (hideTimer_->remainingTime() > minimumLeft) {
+            hideTimer_->start(minimumLeft);
+        }
+    }
+}
+
+void NotificationWidget::showNext()
+{
+    if (queue_.isEmpty()) {
+        active_ = false;
+        hide();
+        return;
+    }
+
+    current_ = queue_.takeFirst();
+    active_ = true;
+
+    updateDisplayText();
+    updateGeometryForText();
+    setOpacity(1.0);
     show();
     raise();
-    
-    hideTimer_->start(duration);
+
+    shownTimer_.start();
+    hideTimer_->start(queue_.isEmpty() ? current_.duration : MIN_DISPLAY_MS);
 }
 
-void NotificationWidget::positionWidget()
+void NotificationWidget::updateDisplayText()
 {
-    if (!parent()) return;
+    displayText_ = current_.count > 1
+        ? QString("%1 (x%2)").arg(current_.message, QString::number(current_.count))
+        : current_.message;
+}
 
-    QWidget* parentWidget = qobject_cast<QWidget*>(parent());
-    if (!parentWidget) return;
+void NotificationWidget::updateGeometryForText()
+{
+    QWidget* parent = parentWidget();
+    int maxWidth = parent ? qMax(200, parent->width() * 4 / 5) : 600;
 
-    // Position in bottom-center of parent
-    QSize parentSize = parentWidget->size();
-    QSize thisSize = sizeHint();
+    QFontMetrics metrics(font_);
+    QRect textRect = metrics.boundingRect(QRect(0, 0, maxWidth - 2 * H_PADDING, 10000),
+                                          Qt::AlignCenter | Qt::TextWordWrap, displayText_);
+    resize(textRect.width() + 2 * H_PADDING, textRect.height() + 2 * V_PADDING);
+    positionWidget();
+}
 
-    int x = (parentSize.width() - thisSize.width()) / 2;
-    int y = parentSize.height() - thisSize.height() - 80;
+void NotificationWidget::positionWidget()
+{
+    QWidget* parent = parentWidget();
+    if (!parent) return;
 
-    // Convert to global coordinates
-    QPoint globalPos = parentWidget->mapToGlobal(QPoint(x, y));
-    move(globalPos);
+    // Position in bottom-center of parent
+    int x = (parent->width() - width()) / 2;
+    int y = parent->height() - height() - BOTTOM_OFFSET;
+    move(x, y);
 }
 
 void NotificationWidget::fadeOut()
 {
-    fadeAnimation_->setStartValue(1.0);
-    fadeAnimation_->setEndValue(0.0);
     fadeAnimation_->start();
 }
 
-void NotificationWidget::hideNotification()
+void NotificationWidget::onFadeFinished()
 {
-    if (windowOpacity() <= 0.0) {
-        hide();
-    }
+    showNext();
 }
 
-void NotificationWidget::showEvent(QShowEvent* event)
+void NotificationWidget::paintEvent(QPaintEvent* event)
 {
-    positionWidget();
-    QWidget::showEvent(event);
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setOpacity(opacity_);
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(backgrounds_[current_.severity]);
+    painter.drawRoundedRect(rect(), CORNER_RADIUS, CORNER_RADIUS);
+
+    painter.setPen(Qt::white);
+    painter.setFont(font_);
+    painter.drawText(rect().adjusted(H_PADDING, V_PADDING, -H_PADDING, -V_PADDING),
+                     Qt::AlignCenter | Qt::TextWordWrap, displayText_);
 }
 
-void NotificationWidget::resizeEvent(QResizeEvent* event)
+bool NotificationWidget::eventFilter(QObject* watched, QEvent* event)
 {
-    positionWidget();
-    QWidget::resizeEvent(event);
-}
\ No newline at end of file
+    // Follow the parent window when it is resized
+    if (watched == parentWidget() && event->type() == QEvent::Resize && active_) {
+        updateGeometryForText();
+    }
+    return QWidget::eventFilter(watched, event);
+}
@@ -2,35 +2,79 @@
 #define NOTIFICATIONWIDGET_H
 
 #include <QWidget>
-#include <QLabel>
 #include <QTimer>
 #include <QPropertyAnimation>
+#include <QElapsedTimer>
+#include <QColor>
+#include <QFont>
+#include <QList>
 
+// In-window toast layer. Lives as a child of the main window (no separate
+// top-level window), queues messages, merges duplicates and fades by painting
+// with a reduced opacity rather than animating the window itself.
 class NotificationWidget : public QWidget
 {
     Q_OBJECT
+    Q_PROPERTY(qreal opacity READ opacity WRITE setOpacity)
 
 public:
     explicit NotificationWidget(QWidget* parent = nullptr);
-    
+
     void showNotification(const QString& message, int duration = 3000);
     void showError(const QString& message, int duration = 5000);
     void showSuccess(const QString& message, int duration = 3000);
 
+    qreal opacity() const { return opacity_; }
+    void setOpacity(qreal opacity);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
 private slots:
     void fadeOut();
-    void hideNotification();
+    void onFadeFinished();
 
 private:
-    QLabel* messageLabel_;
+    enum Severity {
+        Info = 0,
+        Success,
+        Error,
+        SeverityCount
+    };
+
+    struct Entry {
+        QString message;
+        Severity severity = Info;
+        int duration = 0;
+        int count = 1;
+    };
+
+    // Bursts are shown back to back, each for at least this long
+    static constexpr int MIN_DISPLAY_MS = 800;
+    static constexpr int MAX_QUEUED = 5;
+    static constexpr int FADE_MS = 300;
+
     QTimer* hideTimer_;
     QPropertyAnimation* fadeAnimation_;
-    
+    QList<Entry> queue_;
+    Entry current_;
+    bool active_;
+    qreal opacity_;
+    QString displayText_;
+    QElapsedTimer shownTimer_;
+
+    // Precomputed once; nothing is rebuilt per message
+    QColor backgrounds_[SeverityCount];
+    QFont font_;
+
     void setupUI();
     void setupAnimation();
+    void enqueue(const QString& message, Severity severity, int duration);
+    void showNext();
+    void updateDisplayText();
+    void updateGeometryForText();
     void positionWidget();
-    void showEvent(QShowEvent* event) override;
-    void resizeEvent(QResizeEvent* event) override;
 };
 
-#endif // NOTIFICATIONWIDGET_H
\ No newline at end of file
+#endif // NOTIFICATIONWIDGET_H
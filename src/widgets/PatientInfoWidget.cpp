@@ -40,6 +40,7 @@ void PatientInfoWidget::setupUI()
     int fieldHeight = screenSize.height() * 0.05; // 5% of screen height
     firstNameLabel_->setMinimumWidth(labelWidth);
     firstNameEdit_ = new QLineEdit();
+    firstNameEdit_->setObjectName("firstNameEdit");
     firstNameEdit_->setMinimumHeight(fieldHeight);
     firstNameEdit_->setPlaceholderText("First name");
     nameLayout->addWidget(firstNameLabel_);
@@ -107,6 +108,9 @@ void PatientInfoWidget::updateStyles()
         "   border: 2px solid #1976D2;"
         "   background-color: white;"
         "}"
+        "QLineEdit[invalid=\"true\"] {"
+        "   border: 2px solid #DC143C;"
+        "}"
     );
     
     // Other fields use regular font (but they're hidden anyway)
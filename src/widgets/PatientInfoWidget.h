@@ -20,6 +20,9 @@ public:
     
     void setFrozen(bool frozen);
     bool isFrozen() const { return frozen_; }
+
+    // The one required patient field, read by the form's validation rules
+    QLineEdit* firstNameInput() const { return firstNameEdit_; }
     
     void clear();
     
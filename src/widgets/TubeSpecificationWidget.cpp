@@ -1,6 +1,7 @@
 #include "TubeSpecificationWidget.h"
 #include "utils/StyleManager.h"
 #include "utils/SATrachTube.h"
+#include "utils/TubeEquivalence.h"
 #include <QGuiApplication>
 #include <QScreen>
 
@@ -14,6 +15,7 @@ TubeSpecificationWidget::TubeSpecificationWidget(QWidget* parent)
     , outerDiameterLabel_(nullptr)
     , lengthLabel_(nullptr)
     , suctionCatheterLabel_(nullptr)
+    , equivalentsLabel_(nullptr)
     , reorderEdit_(nullptr)
     , inputGroup_(nullptr)
     , calculatedGroup_(nullptr)
@@ -25,6 +27,10 @@ TubeSpecificationWidget::TubeSpecificationWidget(QWidget* parent)
     setupStyling();
     connectSignals();
     populateManufacturerCombo();
+
+    connect(&TubeCatalog::instance(), &TubeCatalog::catalogChanged, this, &TubeSpecificationWidget::onCatalogChanged);
+    connect(&TubeEquivalence::instance(), &TubeEquivalence::tablesChanged,
+            this, &TubeSpecificationWidget::updateCalculatedFields);
 }
 
 void TubeSpecificationWidget::setupUI()
@@ -77,6 +83,7 @@ void TubeSpecificationWidget::setupUI()
     QLabel* typeLabel = new QLabel("Type:");
     typeLabel->setStyleSheet("color: #546E7A; font-size: 32px;");
     typeEdit_ = new QLineEdit();
+    typeEdit_->setObjectName("tubeTypeEdit");
     typeEdit_->setMinimumHeight(40);
     typeEdit_->setPlaceholderText("e.g., Pediatric, Neonatal");
     gridLayout->addWidget(typeLabel, 2, 0);
@@ -144,6 +151,15 @@ void TubeSpecificationWidget::setupUI()
     suctionCatheterLabel_->setStyleSheet("QLabel { font-weight: bold; font-size: 32px; color: #1976D2; }");
     calcLayout->addWidget(suctionLabel, 2, 1);
     calcLayout->addWidget(suctionCatheterLabel_, 3, 1);
+
+    // Full width: closest tubes from the other manufacturers
+    QLabel* equivalentsTitle = new QLabel("Closest Equivalents:");
+    equivalentsTitle->setStyleSheet("color: #546E7A; font-size: 32px;");
+    equivalentsLabel_ = new QLabel("—");
+    equivalentsLabel_->setWordWrap(true);
+    equivalentsLabel_->setStyleSheet("QLabel { font-size: 28px; color: #37474F; }");
+    calcLayout->addWidget(equivalentsTitle, 4, 0, 1, 2);
+    calcLayout->addWidget(equivalentsLabel_, 5, 0, 1, 2);
     
     mainLayout->addWidget(calculatedGroup_);
     
@@ -182,6 +198,9 @@ void TubeSpecificationWidget::setupStyling()
         "QComboBox:disabled, QLineEdit:disabled {"
         "   background-color: #F5F5F5;"
         "   color: #9E9E9E;"
+        "}"
+        "QComboBox[invalid=\"true\"], QLineEdit[invalid=\"true\"] {"
+        "   border: 2px solid #DC143C;"
         "}";
     
     manufacturerCombo_->setStyleSheet(inputStyle);
@@ -248,16 +267,14 @@ void TubeSpecificationWidget::populateSizeComboForManufacturer(const QString& ma
         return;
     }
     
-    // Add common sizes based on manufacturer
+    // Sizes the tube catalog has diameters for, including any loaded from file
     QStringList sizes;
-    if (manufacturer == "Bivona") {
-        sizes = SATrachTube::BivPedTrachSizes; // Full range
-    } else if (manufacturer == "Shiley") {
-        sizes = SATrachTube::ShiPedTrachSizes;
-        sizes.append(SATrachTube::ShiPedXExtraLongTrachSizes); // Add extended sizes
-    } else if (manufacturer == "Tracoe") {
-        sizes = SATrachTube::TracPedTrachSizes;
-    } else {
+    const TubeManufacturer catalogManufacturer = SATrachTube::manufacturerFromName(manufacturer);
+    const QVector<int> catalogSizes = TubeCatalog::sizes(catalogManufacturer);
+    for (int sizeTenths : catalogSizes) {
+        sizes.append(QString::number(sizeTenths / 10.0, 'f', 1));
+    }
+    if (sizes.isEmpty()) {
         // Custom - add standard range
         sizes = SATrachTube::TrachSizes;
     }
@@ -284,6 +301,23 @@ void TubeSpecificationWidget::onManufacturerChanged()
     emit specificationChanged();
 }
 
+void TubeSpecificationWidget::onCatalogChanged()
+{
+    // Refresh the size list and calculated values without touching the
+    // entered specification
+    QString manufacturer = manufacturerCombo_->currentData().toString();
+    if (manufacturer.isEmpty()) return;
+
+    QString sizeText = sizeCombo_->currentText();
+    populateSizeComboForManufacturer(manufacturer);
+
+    updating_ = true;
+    sizeCombo_->setCurrentText(sizeText);
+    updating_ = false;
+
+    updateCalculatedFields();
+}
+
 void TubeSpecificationWidget::onSizeChanged()
 {
     if (updating_) return;
@@ -314,6 +348,7 @@ void TubeSpecificationWidget::updateCalculatedFields()
         outerDiameterLabel_->setText("—");
         lengthLabel_->setText("—");
         suctionCatheterLabel_->setText("—");
+        equivalentsLabel_->setText("—");
         return;
     }
     
@@ -324,6 +359,7 @@ void TubeSpecificationWidget::updateCalculatedFields()
         outerDiameterLabel_->setText("—");
         lengthLabel_->setText("—");
         suctionCatheterLabel_->setText("—");
+        equivalentsLabel_->setText("—");
         return;
     }
     
@@ -358,6 +394,23 @@ void TubeSpecificationWidget::updateCalculatedFields()
     } else {
         suctionCatheterLabel_->setText("Not available");
     }
+
+    const int variant = TubeCatalog::variantFor(SATrachTube::manufacturerFromName(manufacturer), typeEdit_->text());
+    const QVector<TubeEquivalence::Match>& matches =
+        TubeEquivalence::instance().matches(variant, TubeCatalog::toTenths(size));
+    QStringList lines;
+    for (const TubeEquivalence::Match& match : matches) {
+        QString line = QString("%1 %2 (OD %3 mm, shaft %4 mm")
+                           .arg(TubeEquivalence::variantName(match.variant))
+                           .arg(match.sizeTenths / 10.0, 0, 'f', 1)
+                           .arg(match.outerDiameterTenths / 10.0, 0, 'f', 1)
+                           .arg(match.distalShaftMm);
+        if (match.proximalShaftMm > 0) {
+            line += QString(" + %1 mm proximal").arg(match.proximalShaftMm);
+        }
+        lines.append(line + ")");
+    }
+    equivalentsLabel_->setText(lines.isEmpty() ? QString("Not available") : lines.join("\n"));
 }
 
 void TubeSpecificationWidget::setSpecification(const SpecificationTableRow& spec)
@@ -367,16 +420,16 @@ void TubeSpecificationWidget::setSpecification(const SpecificationTableRow& spec
     // Find manufacturer in combo box by exact data match
     for (int i = 0; i < manufacturerCombo_->count(); ++i) {
         QString itemData = manufacturerCombo_->itemData(i).toString();
-        if (itemData.compare(spec.makeModel, Qt::CaseInsensitive) == 0) {
+        if (itemData.compare(spec.makeModel(), Qt::CaseInsensitive) == 0) {
             manufacturerCombo_->setCurrentIndex(i);
             populateSizeComboForManufacturer(manufacturerCombo_->currentData().toString());
             break;
         }
     }
     
-    sizeCombo_->setCurrentText(spec.size);
-    typeEdit_->setText(spec.type);
-    cuffEdit_->setText(spec.cuff);
+    sizeCombo_->setCurrentText(spec.size());
+    typeEdit_->setText(spec.type());
+    cuffEdit_->setText(spec.cuff());
     
     if (spec.length > 0) {
         lengthEdit_->setText(QString::number(spec.length));
@@ -398,10 +451,10 @@ SpecificationTableRow TubeSpecificationWidget::getSpecification() const
 {
     SpecificationTableRow spec;
 
-    spec.makeModel = manufacturerCombo_->currentData().toString();
-    spec.size = sizeCombo_->currentText();
-    spec.type = typeEdit_->text();
-    spec.cuff = cuffEdit_->text();
+    spec.setMakeModel(manufacturerCombo_->currentData().toString());
+    spec.setSize(sizeCombo_->currentText());
+    spec.setType(typeEdit_->text());
+    spec.setCuff(cuffEdit_->text());
     
     // Get length from manual input
     spec.length = lengthEdit_->text().toDouble();
@@ -453,29 +506,12 @@ void TubeSpecificationWidget::setReadOnly(bool readOnly)
     reorderEdit_->setReadOnly(readOnly);
 }
 
-bool TubeSpecificationWidget::isValid() const
+QString TubeSpecificationWidget::manufacturer() const
 {
-    return !manufacturerCombo_->currentData().toString().isEmpty() &&
-           !sizeCombo_->currentText().isEmpty();
+    return manufacturerCombo_->currentData().toString();
 }
 
-QStringList TubeSpecificationWidget::getValidationErrors() const
+QString TubeSpecificationWidget::sizeText() const
 {
-    QStringList errors;
-    
-    if (manufacturerCombo_->currentData().toString().isEmpty()) {
-        errors << "Please select a manufacturer";
-    }
-    
-    if (sizeCombo_->currentText().isEmpty()) {
-        errors << "Please select a tube size";
-    } else {
-        bool ok;
-        sizeCombo_->currentText().toDouble(&ok);
-        if (!ok) {
-            errors << "Please enter a valid tube size";
-        }
-    }
-    
-    return errors;
+    return sizeCombo_->currentText();
 }
\ No newline at end of file
@@ -26,8 +26,12 @@ public:
     void clear();
     void setReadOnly(bool readOnly);
     
-    bool isValid() const;
-    QStringList getValidationErrors() const;
+    // Current inputs, read by the form's validation rules
+    QString manufacturer() const;
+    QString sizeText() const;
+    QString typeText() const { return typeEdit_->text(); }
+    QWidget* manufacturerInput() const { return manufacturerCombo_; }
+    QWidget* sizeInput() const { return sizeCombo_; }
 
 signals:
     void specificationChanged();
@@ -38,6 +42,7 @@ private slots:
     void onManufacturerChanged();
     void onSizeChanged();
     void onFieldChanged();
+    void onCatalogChanged();
     void updateCalculatedFields();
 
 private:
@@ -59,6 +64,7 @@ private:
     QLabel* outerDiameterLabel_;
     QLabel* lengthLabel_;
     QLabel* suctionCatheterLabel_;
+    QLabel* equivalentsLabel_;
     QLineEdit* reorderEdit_;
     
     // Layout components